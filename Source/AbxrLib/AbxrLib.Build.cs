@@ -32,9 +32,17 @@ public class AbxrLib : ModuleRules
             "InputCore",
             "ApplicationCore",
             "HeadMountedDisplay",
-            "XRBase"
+            "XRBase",
+            "RenderCore",
+            "RHI"
         });
         
+        // Local server for the transport automation tests
+        if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+        {
+            PrivateDependencyModuleNames.Add("HTTPServer");
+        }
+
         if (Target.Platform == UnrealTargetPlatform.Win64)
         {
             PublicSystemLibraries.AddRange(new string[]
@@ -1,7 +1,9 @@
 #include "AbxrLibAPI.h"
 #include "UI/AbxrUISubsystem.h"
+#include "Subsystems/TelemetrySubsystem.h"
 #include "AbxrLibAPI_Internal.h"
 #include "Types/AbxrLog.h"
+#include "Services/Transport/AbxrHttpTransport.h"
 
 namespace Abxr
 {
@@ -274,6 +276,16 @@ namespace Abxr
 		TMap<FString, FString> Meta;
 		Telemetry(Name, Meta);
 	}
+	void TelemetryTyped(const FAbxrAtom& Name, const TConstArrayView<FAbxrTelemetryField> Fields)
+	{
+		UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		if (Subsystem == nullptr)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Not initialized yet. TelemetryTyped() failed."));
+			return;
+		}
+		Subsystem->TelemetryTyped(Name, Fields);
+	}
 	
 	void EventAssessmentStart(const FString& AssessmentName, TMap<FString, FString>& Meta)
 	{
@@ -688,4 +700,74 @@ namespace Abxr
 		}
 		Subsystem->LoadSuperMetaData();
 	}
+
+	EAbxrSendCircuitState GetSendCircuitState()
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		if (Subsystem == nullptr)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Not initialized yet. GetSendCircuitState() failed."));
+			return EAbxrSendCircuitState::Closed;
+		}
+		return Subsystem->GetSendCircuitState();
+	}
+
+	FAbxrTransportStats GetTransportStats()
+	{
+		// Process-wide, so available before the subsystem is
+		return FAbxrHttpTransport::Get().GetStats();
+	}
+
+	FAbxrIngestStats GetIngestStats()
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		if (Subsystem == nullptr)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Not initialized yet. GetIngestStats() failed."));
+			return FAbxrIngestStats();
+		}
+		return Subsystem->GetIngestStats();
+	}
+
+	int32 RegisterTelemetryCapture(const FName Name, const double PeriodSeconds, TFunction<void()> Capture)
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		UTelemetrySubsystem* Telemetry = Subsystem ? Subsystem->GetTelemetrySubsystem() : nullptr;
+		if (Telemetry == nullptr)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Not initialized yet. RegisterTelemetryCapture() failed."));
+			return INDEX_NONE;
+		}
+		return Telemetry->RegisterCapture(Name, PeriodSeconds, MoveTemp(Capture));
+	}
+
+	void UnregisterTelemetryCapture(const int32 Handle)
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		if (UTelemetrySubsystem* Telemetry = Subsystem ? Subsystem->GetTelemetrySubsystem() : nullptr)
+		{
+			Telemetry->UnregisterCapture(Handle);
+		}
+	}
+
+	void RegisterTelemetryProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider)
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		UTelemetrySubsystem* Telemetry = Subsystem ? Subsystem->GetTelemetrySubsystem() : nullptr;
+		if (Telemetry == nullptr)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Not initialized yet. RegisterTelemetryProvider() failed."));
+			return;
+		}
+		Telemetry->RegisterProvider(Provider);
+	}
+
+	void UnregisterTelemetryProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider)
+	{
+		const UAbxrSubsystem* Subsystem = AbxrLib_GetActiveSubsystem();
+		if (UTelemetrySubsystem* Telemetry = Subsystem ? Subsystem->GetTelemetrySubsystem() : nullptr)
+		{
+			Telemetry->UnregisterProvider(Provider);
+		}
+	}
 }
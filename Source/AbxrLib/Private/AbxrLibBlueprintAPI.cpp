@@ -133,3 +133,6 @@ void UAbxrLibBlueprintAPI::Unregister(const FString& Key) { Abxr::Unregister(Key
 void UAbxrLibBlueprintAPI::Reset() { Abxr::Reset(); }
 TMap<FString, FString> UAbxrLibBlueprintAPI::GetSuperMetaData() { return Abxr::GetSuperMetaData(); }
 void UAbxrLibBlueprintAPI::LoadSuperMetaData() { Abxr::LoadSuperMetaData(); }
+EAbxrSendCircuitState UAbxrLibBlueprintAPI::GetSendCircuitState() { return Abxr::GetSendCircuitState(); }
+FAbxrTransportStats UAbxrLibBlueprintAPI::GetTransportStats() { return Abxr::GetTransportStats(); }
+FAbxrIngestStats UAbxrLibBlueprintAPI::GetIngestStats() { return Abxr::GetIngestStats(); }
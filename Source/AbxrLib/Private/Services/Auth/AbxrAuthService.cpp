@@ -2,19 +2,21 @@
 #include "AbxrLibAPI.h"
 #include "Services/Config/AbxrSettings.h"
 #include "Util/AbxrUtil.h"
-#include "HttpModule.h"
+#include "Util/AbxrSecureFile.h"
+#include "Util/AbxrJwt.h"
+#include "Util/AbxrSha256.h"
+#include "Services/Transport/AbxrHttpTransport.h"
 #include "JsonObjectConverter.h"
 #include "Services/Platform/XRDM/XRDMService.h"
 #include "Interfaces/IHttpResponse.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Misc/Base64.h"
 #include "HAL/PlatformMisc.h"
 #include "Interfaces/IPluginManager.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Async/Async.h"
 #include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
 #include "Types/AbxrLog.h"
 #if PLATFORM_ANDROID
 #include "Android/AndroidApplication.h"
@@ -46,13 +48,13 @@ void FAbxrAuthService::CancelRetryTimer()
 void FAbxrAuthService::ScheduleRetry(TFunction<void()> Fn)
 {
 	CancelRetryTimer();
-	if (bStopping || !bAttemptActive) return;
+	if (!IsRequestLive()) return;
 
 	RetryTickHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateLambda([AuthPtr = AsWeak(), Fn = MoveTemp(Fn)](float) mutable
 		{
 			const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
-			if (!Self || Self->bStopping || !Self->bAttemptActive) return false;
+			if (!Self || !Self->IsRequestLive()) return false;
 			Fn();
 			return false; // one-shot
 		}),
@@ -84,23 +86,29 @@ FAbxrAuthService::FAbxrAuthService(const FAbxrAuthCallbacks& callbacks, UXRDMSer
 	Payload.UnrealVersion = FString::Printf(TEXT("%d.%d.%d"), ENGINE_MAJOR_VERSION, ENGINE_MINOR_VERSION, ENGINE_PATCH_VERSION);
 	Payload.AbxrLibVersion = IPluginManager::Get().FindPlugin(TEXT("AbxrLib"))->GetDescriptor().VersionName;
 	Payload.AbxrLibType = TEXT("unreal");
+
+	ForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddRaw(this, &FAbxrAuthService::HandleEnteredForeground);
 }
 
 FAbxrAuthService::~FAbxrAuthService()
 {
 	bStopping = true;
+	FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(ForegroundHandle);
 	CancelRetryTimer();
-	StopReAuthPolling();
+	StopReAuthTimer();
 	if (ActiveRequest.IsValid()) ActiveRequest->CancelRequest();
+	if (ConfigRequest.IsValid()) ConfigRequest->CancelRequest();
 	bAttemptActive = false;
 }
 
 void FAbxrAuthService::Authenticate()
 {
-	if (bStopping || bAttemptActive) return;
+	// A session refresh behind a warm start counts as an attempt in progress, like any other
+	if (bStopping || bAttemptActive || bSessionRefreshActive) return;
 	bAttemptActive = true;
-	StopReAuthPolling();
+	StopReAuthTimer();
 	ClearAuthenticationState();
+	AttemptStartSeconds = StageStartSeconds = FPlatformTime::Seconds();
 	if (!GetDefault<UAbxrSettings>()->IsValid())
 	{
 		bAttemptActive = false;
@@ -110,6 +118,8 @@ void FAbxrAuthService::Authenticate()
 
 	GetConfigData();
 	if (CheckAuthHandoff()) return;
+	// Read on a worker while XRDM connects and the token request is in flight; a restored token may finish the attempt early
+	LoadDiskCache();
 	
 	auto KickAuthChain = [AuthPtr = AsWeak()](bool bConnected)
 	{
@@ -117,35 +127,38 @@ void FAbxrAuthService::Authenticate()
 		AsyncTask(ENamedThreads::GameThread, [AuthPtr, bConnected]
 		{
 			const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
-			if (!Self || Self->bStopping || !Self->bAttemptActive) return;
+			if (!Self || !Self->IsAuthChainLive()) return;
+			Self->LogStage(TEXT("device"));
 #if PLATFORM_ANDROID
 			if (bConnected) Self->GetArborData();
 #endif
 			Self->AuthRequest([AuthPtr](const bool bSuccess)
 			{
 				const TSharedPtr<FAbxrAuthService> Self2 = AuthPtr.Pin();
-				if (!Self2 || Self2->bStopping || !Self2->bAttemptActive) return;
+				if (!Self2 || !Self2->IsAuthChainLive()) return;
 				if (bSuccess)
 				{
-					Self2->GetConfiguration([AuthPtr](const bool)
+					Self2->LogStage(TEXT("token"));
+					Self2->SaveSession();
+					Self2->StartReAuthTimer();
+					if (Self2->bSessionRefreshActive)
 					{
-						const TSharedPtr<FAbxrAuthService> Self3 = AuthPtr.Pin();
-						if (!Self3 || Self3->bStopping || !Self3->bAttemptActive) return;
-						if (Self3->Payload.AuthMechanism.Contains(TEXT("type")))
-						{
-							Self3->RequestKeyboardInput(true);
-						}
-						else
-						{
-							Self3->AuthSucceeded();
-						}
-					});
-
-					Self2->StartReAuthPolling();
+						// Already running on the restored token; this launch's own token just replaces it
+						Self2->bSessionRefreshActive = false;
+						Self2->bWarmStarted = false;
+						return;
+					}
+					Self2->RequestConfiguration();
+				}
+				else if (Self2->bSessionRefreshActive)
+				{
+					Self2->bSessionRefreshActive = false;
+					UE_LOG(LogAbxrLib, Warning, TEXT("Could not start a new session; continuing on the restored token"));
 				}
 				else
 				{
 					Self2->bAttemptActive = false;
+					FAbxrSecureFile::Delete(GetSessionCachePath());
 					Self2->Callbacks.OnFailed(TEXT("Initial authentication request failed"));
 				}
 			});
@@ -170,24 +183,222 @@ void FAbxrAuthService::Authenticate()
 #endif
 }
 
-void FAbxrAuthService::StartReAuthPolling()
+void FAbxrAuthService::RequestConfiguration()
 {
-	if (ReAuthTickHandle.IsValid()) return;
-	
-	NextReAuthCheckAtSeconds = FPlatformTime::Seconds() + ReAuthPollSeconds;
+	// With a last-known config that needs no login prompt, finish now and let the fresh one replace it when it lands.
+	// Without one (first run, or the load has not finished yet) wait for the server as before.
+	const bool bOptimistic = CachedConfig.IsSet() && !CachedConfig->AuthMechanism.Contains(TEXT("type"));
+	if (bOptimistic)
+	{
+		SetConfigFromPayload(CachedConfig.GetValue());
+		Payload.AuthMechanism = CachedConfig->AuthMechanism;
+		bConfigRefreshActive = true;
+		AuthSucceeded();
+	}
+
+	GetConfiguration([AuthPtr = AsWeak(), bOptimistic](const bool bSuccess, const int32 ResponseCode)
+	{
+		const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
+		if (!Self || Self->bStopping) return;
+		Self->LogStage(TEXT("config"));
+
+		if (bOptimistic) Self->bConfigRefreshActive = false;
+		const bool bWarmStarted = Self->bWarmStarted;
+		Self->bWarmStarted = false;
+		if (!bSuccess && bWarmStarted && (ResponseCode == EHttpResponseCodes::Denied || ResponseCode == EHttpResponseCodes::Forbidden))
+		{
+			// The server would not take the restored token; drop it and authenticate from scratch.
+			// Anything else (offline, 5xx) says nothing about the token, so it is kept and the usual paths below apply.
+			UE_LOG(LogAbxrLib, Warning, TEXT("Persisted token was not accepted (%d); re-authenticating"), ResponseCode);
+			FAbxrSecureFile::Delete(GetSessionCachePath());
+			Self->bAuthenticated = false;
+			if (Self->bSessionRefreshActive)
+			{
+				// This launch's token request is already in flight; let it finish the attempt without reporting success twice
+				Self->bSessionRefreshActive = false;
+				Self->bAttemptActive = true;
+				Self->bSuccessReported = true;
+				return;
+			}
+			Self->bAttemptActive = false;
+			Self->Authenticate();
+			return;
+		}
+
+		if (bOptimistic)
+		{
+			if (!bSuccess)
+			{
+				UE_LOG(LogAbxrLib, Warning, TEXT("Configuration refresh failed; keeping the cached configuration"));
+				return;
+			}
+			if (Self->Callbacks.OnConfigUpdated) Self->Callbacks.OnConfigUpdated();
+
+			// The cached config was stale and the server now wants a login; prompt on the live token
+			if (Self->Payload.AuthMechanism.Contains(TEXT("type")) && !Self->bAttemptActive)
+			{
+				Self->bAttemptActive = true;
+				Self->RequestKeyboardInput(true);
+			}
+			return;
+		}
+
+		if (!Self->bAttemptActive) return;
+		if (Self->Payload.AuthMechanism.Contains(TEXT("type")))
+		{
+			Self->RequestKeyboardInput(true);
+		}
+		else
+		{
+			Self->AuthSucceeded();
+		}
+	});
+}
+
+TOptional<FAbxrConfigPayload> FAbxrAuthService::LoadCachedConfig(const FString& AppToken)
+{
+	FString Json;
+	if (!FAbxrSecureFile::Load(GetConfigCachePath(), AppToken, Json)) return {};
+
+	FAbxrConfigPayload Config;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Config, 0, 0))
+	{
+		UE_LOG(LogAbxrLib, Warning, TEXT("Ignoring unreadable cached configuration"));
+		return {};
+	}
+	return Config;
+}
+
+void FAbxrAuthService::SaveCachedConfig(const FString& Json)
+{
+	Async(EAsyncExecution::ThreadPool, [Json, AppToken = GetDefault<UAbxrSettings>()->AppToken]
+	{
+		if (!FAbxrSecureFile::Save(GetConfigCachePath(), Json, AppToken))
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Failed to cache configuration to %s"), *GetConfigCachePath());
+		}
+	});
+}
+
+FString FAbxrAuthService::GetConfigCachePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbxrLib"), TEXT("Config.bin"));
+}
+
+TOptional<FAbxrPersistedAuth> FAbxrAuthService::LoadSession(const FString& AppToken)
+{
+	FString Json;
+	if (!FAbxrSecureFile::Load(GetSessionCachePath(), AppToken, Json)) return {};
+
+	FAbxrPersistedAuth Session;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Session, 0, 0) || Session.Response.Token.IsEmpty()) return {};
+	return Session;
+}
+
+void FAbxrAuthService::LoadDiskCache()
+{
+	// Only the first authentication of a run; later ones have a live token or want a fresh one
+	if (bDiskCacheLoadStarted) return;
+	bDiskCacheLoadStarted = true;
+
+	Async(EAsyncExecution::ThreadPool, [AuthPtr = AsWeak(), AppToken = Payload.AppToken]
+	{
+		TOptional<FAbxrPersistedAuth> Session = LoadSession(AppToken);
+		TOptional<FAbxrConfigPayload> Config = LoadCachedConfig(AppToken);
+		AsyncTask(ENamedThreads::GameThread, [AuthPtr, Session = MoveTemp(Session), Config = MoveTemp(Config)]
+		{
+			const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
+			if (!Self || Self->bStopping) return;
+			// A fresh fetch that already landed is newer than the file
+			if (!Self->CachedConfig.IsSet()) Self->CachedConfig = Config;
+			if (Session.IsSet()) Self->TryWarmStart(Session.GetValue());
+		});
+	});
+}
+
+void FAbxrAuthService::TryWarmStart(const FAbxrPersistedAuth& Session)
+{
+	// Too late to help: the attempt already ended, or this launch's own token arrived first
+	if (!bAttemptActive || bAuthenticated || TokenExpiry > 0) return;
+
+	const int64 Remaining = Session.TokenExpiry - FDateTime::UtcNow().ToUnixTimestamp();
+	if (Remaining <= ReAuthThresholdSeconds) return;
+
+	// Apps that log a user in never warm start: the next person on the headset must sign in themselves
+	if (!CachedConfig.IsSet() || CachedConfig->AuthMechanism.Contains(TEXT("type"))) return;
+
+	{
+		FScopeLock Lock(&CredentialsLock);
+		ResponseData = Session.Response;
+	}
+	TokenExpiry = Session.TokenExpiry;
+	bWarmStarted = true;
+	// Keeps the auth chain alive after the optimistic success below; it fetches this launch's own session token
+	bSessionRefreshActive = true;
+	LogStage(TEXT("warm start"));
+	UE_LOG(LogAbxrLib, Log, TEXT("Reusing persisted token (expires in %lld s)"), Remaining);
+
+	RequestConfiguration();
+}
+
+void FAbxrAuthService::SaveSession() const
+{
+	if (TokenExpiry <= 0) return;
+
+	FAbxrPersistedAuth Session;
+	{
+		FScopeLock Lock(&CredentialsLock);
+		Session.Response = ResponseData;
+	}
+	Session.TokenExpiry = TokenExpiry;
+
+	FString Json;
+	FJsonObjectConverter::UStructToJsonObjectString(Session, Json);
+	Async(EAsyncExecution::ThreadPool, [Json = MoveTemp(Json), AppToken = Payload.AppToken]
+	{
+		if (!FAbxrSecureFile::Save(GetSessionCachePath(), Json, AppToken))
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Failed to persist the auth token to %s"), *GetSessionCachePath());
+		}
+	});
+}
+
+FString FAbxrAuthService::GetSessionCachePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbxrLib"), TEXT("Session.bin"));
+}
+
+void FAbxrAuthService::LogStage(const TCHAR* Stage)
+{
+	const double Now = FPlatformTime::Seconds();
+	UE_LOG(LogAbxrLib, Log, TEXT("Auth stage '%s' took %.1f ms (%.1f ms since Authenticate)"),
+		Stage, (Now - StageStartSeconds) * 1000.0, (Now - AttemptStartSeconds) * 1000.0);
+	StageStartSeconds = Now;
+}
+
+void FAbxrAuthService::StartReAuthTimer()
+{
+	StopReAuthTimer();
+	if (TokenExpiry <= 0) return;
+
+	// One wakeup, just before the token enters the re-auth window; nothing runs while it is fresh
+	const int64 Delay = FMath::Max<int64>(TokenExpiry - ReAuthThresholdSeconds - FDateTime::UtcNow().ToUnixTimestamp(), 0);
+	ArmReAuthTimer(static_cast<float>(Delay));
+}
 
+void FAbxrAuthService::ArmReAuthTimer(const float DelaySeconds)
+{
 	ReAuthTickHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateLambda([AuthPtr = AsWeak()](float)
 		{
-			if (const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin()) return Self->ReAuthTick();
-			
-			return false;  // stop ticking. service is gone
+			if (const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin()) Self->ReAuthDue();
+			return false; // one-shot
 		}),
-		1.0f
+		DelaySeconds
 	);
 }
 
-void FAbxrAuthService::StopReAuthPolling()
+void FAbxrAuthService::StopReAuthTimer()
 {
 	if (ReAuthTickHandle.IsValid())
 	{
@@ -196,26 +407,30 @@ void FAbxrAuthService::StopReAuthPolling()
 	}
 }
 
-bool FAbxrAuthService::ReAuthTick()
+void FAbxrAuthService::ReAuthDue()
 {
-	const double Now = FPlatformTime::Seconds();
-	if (Now < NextReAuthCheckAtSeconds) return true;
+	ReAuthTickHandle.Reset();
+	if (bStopping) return;
 
-	NextReAuthCheckAtSeconds = Now + ReAuthPollSeconds;
+	// A keyboard login or another attempt is still running; look again shortly
+	if (bAttemptActive || bSessionRefreshActive)
+	{
+		ArmReAuthTimer(ReAuthBusyRetrySeconds);
+		return;
+	}
 
-	if (TokenExpiry <= 0) return true;
-	
-	const int64 Remaining = TokenExpiry - FDateTime::UtcNow().ToUnixTimestamp();
-	if (Remaining > ReAuthThresholdSeconds || bAttemptActive) return true;
-	
 	Authenticate();
+}
 
-	return true;
+void FAbxrAuthService::HandleEnteredForeground()
+{
+	// Ticker time does not advance while the app is suspended, so re-arm against the wall clock
+	if (ReAuthTickHandle.IsValid()) StartReAuthTimer();
 }
 
 void FAbxrAuthService::AuthRequest(TFunction<void(bool)> OnComplete)
 {
-	if (bStopping || !bAttemptActive) { OnComplete(false); return; }
+	if (!IsAuthChainLive()) { OnComplete(false); return; }
 	if (Payload.SessionId.IsEmpty()) Payload.SessionId = FGuid::NewGuid().ToString();
 
 	FString Json;
@@ -226,23 +441,23 @@ void FAbxrAuthService::AuthRequest(TFunction<void(bool)> OnComplete)
 	DoAttempt = [this, AuthPtr = AsWeak(), OnComplete, Json, Attempt, &DoAttempt]
 	{
 		const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
-		if (!Self || Self->bStopping || !Self->bAttemptActive) return;
+		if (!Self || !Self->IsAuthChainLive()) return;
 
-		const TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+		const TSharedRef<IHttpRequest> Request = FAbxrHttpTransport::Get().CreateRequest(TEXT("POST"),
+			FAbxrUtil::CombineUrl(GetDefault<UAbxrSettings>()->RestUrl, TEXT("/v1/auth/token")));
 		Self->ActiveRequest = Request;
-		Request->SetURL(FAbxrUtil::CombineUrl(GetDefault<UAbxrSettings>()->RestUrl, TEXT("/v1/auth/token")));
-		Request->SetVerb(TEXT("POST"));
 		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 		Request->SetContentAsString(Json);
 
 		Request->OnProcessRequestComplete().BindLambda(
-			[AuthPtr, OnComplete, Json, Attempt, DoAttempt](FHttpRequestPtr, const FHttpResponsePtr& Response, const bool bOk) mutable
+			[AuthPtr, OnComplete, Json, Attempt, DoAttempt](const FHttpRequestPtr& Req, const FHttpResponsePtr& Response, const bool bOk) mutable
 			{
+				FAbxrHttpTransport::Get().RecordCompletion(Req);
 				const TSharedPtr<FAbxrAuthService> Self2 = AuthPtr.Pin();
 				if (!Self2) return;
 
 				Self2->ActiveRequest.Reset();
-				if (Self2->bStopping || !Self2->bAttemptActive) return;
+				if (!Self2->IsAuthChainLive()) return;
 
 				const int32 Code = Response.IsValid() ? Response->GetResponseCode() : 0;
 				const FString Body = Response->GetContentAsString();
@@ -276,7 +491,7 @@ void FAbxrAuthService::AuthRequest(TFunction<void(bool)> OnComplete)
 				OnComplete(false);
 			});
 
-		Request->ProcessRequest();
+		FAbxrHttpTransport::Get().ProcessRequest(Request);
 	};
 
 	DoAttempt();
@@ -291,14 +506,17 @@ bool FAbxrAuthService::ParseAuthResponse(const FString& Body, const bool Handoff
 		return false;
 	}
 
-	ResponseData = AuthResponse;
-	if (ResponseData.Modules.Num() > 1)
+	if (AuthResponse.Modules.Num() > 1)
 	{
-		Algo::Sort(ResponseData.Modules, [](const FAbxrModuleData& A, const FAbxrModuleData& B)
+		Algo::Sort(AuthResponse.Modules, [](const FAbxrModuleData& A, const FAbxrModuleData& B)
 		{
 			return A.Order < B.Order;
 		});
 	}
+	{
+		FScopeLock Lock(&CredentialsLock);
+		ResponseData = AuthResponse;
+	}
 	
 	if (Handoff)
 	{
@@ -306,32 +524,9 @@ bool FAbxrAuthService::ParseAuthResponse(const FString& Body, const bool Handoff
 	}
 	else
 	{
-		TArray<FString> Parts;
-		ResponseData.Token.ParseIntoArray(Parts, TEXT("."));
-		if (Parts.Num() >= 2)
-		{
-			FString PayloadB64Url = Parts[1];
-			PayloadB64Url.ReplaceInline(TEXT("-"), TEXT("+"));
-			PayloadB64Url.ReplaceInline(TEXT("_"), TEXT("/"));
-			while (PayloadB64Url.Len() % 4 != 0) PayloadB64Url.AppendChar('=');
-
-			FString DecodedPayloadJson;
-			if (FBase64::Decode(PayloadB64Url, DecodedPayloadJson))
-			{
-				TSharedPtr<FJsonObject> PayloadJson;
-				const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(DecodedPayloadJson);
-				if (FJsonSerializer::Deserialize(Reader, PayloadJson) && PayloadJson.IsValid())
-				{
-					const TSharedPtr<FJsonValue>* ValuePtr = PayloadJson->Values.Find(TEXT("exp"));
-					if (ValuePtr && ValuePtr->IsValid())
-					{
-						const TSharedPtr<FJsonValue> V = *ValuePtr;
-						const int64 Exp = FCString::Atoi64(*V->AsString());
-						TokenExpiry = static_cast<int32>(Exp);
-					}
-				}
-			}
-		}
+		FAbxrJwtClaims Claims;
+		if (FAbxrJwt::ReadClaims(AuthResponse.Token, Claims)) TokenExpiry = Claims.Exp;
+		else UE_LOG(LogAbxrLib, Warning, TEXT("Auth token has no readable exp claim; re-auth will not be scheduled"));
 	}
 	
 	if (Handoff)
@@ -344,42 +539,45 @@ bool FAbxrAuthService::ParseAuthResponse(const FString& Body, const bool Handoff
 	return true;
 }
 
-void FAbxrAuthService::GetConfiguration(TFunction<void(bool)> OnComplete)
+void FAbxrAuthService::GetConfiguration(TFunction<void(bool, int32)> OnComplete)
 {
-	if (bStopping || !bAttemptActive) { OnComplete(false); return; }
+	if (!IsRequestLive()) { OnComplete(false, 0); return; }
 	
 	const TSharedPtr<int32> Attempt = MakeShared<int32>(1);
 	TFunction<void()> DoAttempt;
 	DoAttempt = [this, AuthPtr = AsWeak(), OnComplete, Attempt, &DoAttempt]
 	{
 		const TSharedPtr<FAbxrAuthService> Self = AuthPtr.Pin();
-		if (!Self || Self->bStopping || !Self->bAttemptActive) return;
+		if (!Self || !Self->IsRequestLive()) return;
 
-		const TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
-		Self->ActiveRequest = Request;
-		Request->SetURL(FAbxrUtil::CombineUrl(GetDefault<UAbxrSettings>()->RestUrl, TEXT("/v1/storage/config")));
-		Request->SetVerb(TEXT("GET"));
+		const TSharedRef<IHttpRequest> Request = FAbxrHttpTransport::Get().CreateRequest(TEXT("GET"),
+			FAbxrUtil::CombineUrl(GetDefault<UAbxrSettings>()->RestUrl, TEXT("/v1/storage/config")));
+		Self->ConfigRequest = Request;
 		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 		Self->SetAuthHeaders(Request);
 
 		Request->OnProcessRequestComplete().BindLambda(
-			[AuthPtr, OnComplete, Attempt, DoAttempt](FHttpRequestPtr, const FHttpResponsePtr& Resp, const bool bOk) mutable
+			[AuthPtr, OnComplete, Attempt, DoAttempt](const FHttpRequestPtr& Req, const FHttpResponsePtr& Resp, const bool bOk) mutable
 			{
+				FAbxrHttpTransport::Get().RecordCompletion(Req);
 				const TSharedPtr<FAbxrAuthService> Self2 = AuthPtr.Pin();
 				if (!Self2) return;
 
-				Self2->ActiveRequest.Reset();
-				if (Self2->bStopping || !Self2->bAttemptActive) return;
+				Self2->ConfigRequest.Reset();
+				if (!Self2->IsRequestLive()) return;
 
 				const int32 Code = Resp.IsValid() ? Resp->GetResponseCode() : 0;
 				if (bOk && Resp.IsValid() && EHttpResponseCodes::IsOk(Code))
 				{
+					const FString Body = Resp->GetContentAsString();
 					FAbxrConfigPayload Config;
-					FJsonObjectConverter::JsonObjectStringToUStruct(*Resp->GetContentAsString(), &Config, 0, 0);
+					FJsonObjectConverter::JsonObjectStringToUStruct(Body, &Config, 0, 0);
 					Self2->SetConfigFromPayload(Config);
 					Self2->Payload.AuthMechanism = Config.AuthMechanism;
+					Self2->CachedConfig = Config;
+					SaveCachedConfig(Body);
 					UE_LOG(LogAbxrLib, Log, TEXT("GetConfiguration() successful"));
-					OnComplete(true);
+					OnComplete(true, Code);
 					return;
 				}
 
@@ -395,15 +593,27 @@ void FAbxrAuthService::GetConfiguration(TFunction<void(bool)> OnComplete)
 				}
 
 				UE_LOG(LogAbxrLib, Error, TEXT("GetConfiguration failed (no more retries)"));
-				OnComplete(false);
+				OnComplete(false, Code);
 			});
 
-		Request->ProcessRequest();
+		FAbxrHttpTransport::Get().ProcessRequest(Request);
 	};
 
 	DoAttempt();
 }
 
+static EAbxrDataCompression ParseDataCompression(const FString& Value)
+{
+	if (Value.Equals(TEXT("gzip"), ESearchCase::IgnoreCase)) return EAbxrDataCompression::Gzip;
+	if (Value.Equals(TEXT("zstd"), ESearchCase::IgnoreCase))
+	{
+		// No zstd codec ships with the engine; gzip is the closest thing every backend accepts
+		UE_LOG(LogAbxrLib, Log, TEXT("DataCompression 'zstd' is not supported on this client, using gzip"));
+		return EAbxrDataCompression::Gzip;
+	}
+	return EAbxrDataCompression::None;
+}
+
 void FAbxrAuthService::SetConfigFromPayload(const FAbxrConfigPayload& Payload)
 {
 	UAbxrSettings* Config = GetMutableDefault<UAbxrSettings>();
@@ -417,6 +627,8 @@ void FAbxrAuthService::SetConfigFromPayload(const FAbxrConfigPayload& Payload)
 	if (!Payload.PruneSentItemsOlderThan.IsEmpty()) Config->SetPruneSentItemsOlderThanHours(FCString::Atoi(*Payload.PruneSentItemsOlderThan));
 	if (!Payload.MaximumCachedItems.IsEmpty()) Config->SetMaximumCachedItems(FCString::Atoi(*Payload.MaximumCachedItems));
 	if (!Payload.RetainLocalAfterSent.IsEmpty()) Config->SetRetainLocalAfterSent(Payload.RetainLocalAfterSent.ToBool());
+	if (!Payload.DataCompression.IsEmpty()) Config->SetDataCompression(ParseDataCompression(Payload.DataCompression));
+	if (!Payload.DataCommonMeta.IsEmpty()) Config->SetDataCommonMeta(Payload.DataCommonMeta.ToBool());
 }
 
 void FAbxrAuthService::GetConfigData()
@@ -505,6 +717,15 @@ void FAbxrAuthService::AuthSucceeded()
 {
 	bAttemptActive = false;
 	bAuthenticated = true;
+	StartReAuthTimer();  // the keyboard path issues a second token
+	LogStage(TEXT("authenticated"));
+	if (bSuccessReported)
+	{
+		// The warm start already reported this attempt; the token and config have been swapped underneath it
+		bSuccessReported = false;
+		UE_LOG(LogAbxrLib, Log, TEXT("Replaced the rejected persisted token"));
+		return;
+	}
 	Callbacks.OnSucceeded();
 	UE_LOG(LogAbxrLib, Log, TEXT("Authenticated successfully"));
 }
@@ -563,26 +784,62 @@ void FAbxrAuthService::KeyboardAuthenticate(const FString& KeyboardInput)
 
 void FAbxrAuthService::SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const FString& Json) const
 {
-	Request->SetHeader("Authorization", "Bearer " + ResponseData.Token);
+	if (Json.IsEmpty())
+	{
+		SetAuthHeaders(Request, static_cast<const uint32*>(nullptr));
+		return;
+	}
+	const uint32 CRC = FAbxrUtil::ComputeCRC32(Json);
+	SetAuthHeaders(Request, &CRC);
+}
 
-	const FString UnixTime = LexToString(FDateTime::UtcNow().ToUnixTimestamp());
-	Request->SetHeader("x-abxrlib-timestamp", UnixTime);
+void FAbxrAuthService::SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const TConstArrayView<uint8> Body) const
+{
+	if (Body.IsEmpty())
+	{
+		SetAuthHeaders(Request, static_cast<const uint32*>(nullptr));
+		return;
+	}
+	const uint32 CRC = FAbxrUtil::ComputeCRC32(Body.GetData(), Body.Num());
+	SetAuthHeaders(Request, &CRC);
+}
+
+void FAbxrAuthService::SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const uint32* BodyCRC) const
+{
+	// Called from the game thread and the data worker; each keeps its own digest context
+	static thread_local FAbxrSha256 Hasher;
 
-	FString HashString = ResponseData.Token + ResponseData.Secret + UnixTime;
-	if (!Json.IsEmpty())
+	const FString UnixTime = LexToString(FDateTime::UtcNow().ToUnixTimestamp());
+	FString Token;
 	{
-		const uint32 CRC = FAbxrUtil::ComputeCRC32(Json);
-		HashString += LexToString(CRC);
+		// Hash Token + Secret + UnixTime [+ CRC] piecewise instead of concatenating them first
+		FScopeLock Lock(&CredentialsLock);
+		Token = ResponseData.Token;
+		Hasher.Update(Token);
+		Hasher.Update(ResponseData.Secret);
 	}
-	
-	Request->SetHeader("x-abxrlib-hash", FAbxrUtil::ComputeSHA256(HashString));
+	Hasher.Update(UnixTime);
+	if (BodyCRC)
+	{
+		TCHAR CRCText[16];
+		const int32 Len = FCString::Snprintf(CRCText, UE_ARRAY_COUNT(CRCText), TEXT("%u"), *BodyCRC);
+		Hasher.Update(FStringView(CRCText, Len));
+	}
+
+	Request->SetHeader("Authorization", "Bearer " + Token);
+	Request->SetHeader("x-abxrlib-timestamp", UnixTime);
+	Request->SetHeader("x-abxrlib-hash", Hasher.FinalizeBase64());
 }
 
 void FAbxrAuthService::ClearAuthenticationState()
 {
 	bAuthenticated = false;
-	ResponseData = FAbxrAuthResponse();
+	{
+		FScopeLock Lock(&CredentialsLock);
+		ResponseData = FAbxrAuthResponse();
+	}
 	TokenExpiry = 0;
 	Payload.AuthMechanism.Empty();
+	bSuccessReported = false;
 	UE_LOG(LogAbxrLib, Log, TEXT("Authentication state cleared"));
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
 #include "HAL/ThreadSafeBool.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Types/AbxrTypes.h"
@@ -18,8 +19,11 @@ public:
 	FAbxrAuthResponse GetAuthResponse() { return ResponseData; }
 	void SetSessionId(const FString& sessionId) { Payload.SessionId = sessionId; }
 	void SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const FString& Json) const;
+	void SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, TConstArrayView<uint8> Body) const;
+	// For bodies whose CRC32 was taken while they were built
+	void SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const uint32 BodyCRC) const { SetAuthHeaders(Request, &BodyCRC); }
 	void KeyboardAuthenticate(const FString& KeyboardInput);
-	void StopReAuthPolling();
+	void StopReAuthTimer();
 
 private:
 	static bool ShouldRetry(bool bOk, const FHttpResponsePtr& Response);
@@ -29,9 +33,20 @@ private:
 	void ClearAuthenticationState();
 	void AuthRequest(TFunction<void(bool)> OnComplete);
 	bool ParseAuthResponse(const FString& Body, const bool Handoff);
-	void GetConfiguration(TFunction<void(bool)> OnComplete);
+	// Reports the last HTTP status (0 when there was no response) so callers can tell a rejected token from an outage
+	void GetConfiguration(TFunction<void(bool, int32)> OnComplete);
+	void RequestConfiguration();
+	static TOptional<FAbxrConfigPayload> LoadCachedConfig(const FString& AppToken);
+	static void SaveCachedConfig(const FString& Json);
+	static FString GetConfigCachePath();
+	static TOptional<FAbxrPersistedAuth> LoadSession(const FString& AppToken);
+	void LoadDiskCache();
+	void TryWarmStart(const FAbxrPersistedAuth& Session);
+	void SaveSession() const;
+	static FString GetSessionCachePath();
 	static void SetConfigFromPayload(const FAbxrConfigPayload& Payload);
 	void SetAuthHeaders(const TSharedRef<IHttpRequest>& Request) const { SetAuthHeaders(Request, TEXT("")); }
+	void SetAuthHeaders(const TSharedRef<IHttpRequest>& Request, const uint32* BodyCRC) const;
 	void GetConfigData();
 	void GetArborData();
 	void AuthSucceeded();
@@ -42,28 +57,55 @@ private:
 	FString GetAndroidIntentParam(const FString& Key) const;
 	bool SessionUsedAuthHandoff;
 	
-	bool ReAuthTick();
-	void StartReAuthPolling();
+	void StartReAuthTimer();
+	void ArmReAuthTimer(float DelaySeconds);
+	void ReAuthDue();
+	void HandleEnteredForeground();
+
+	// Requests and retries stay live for an attempt, or for a config refresh that outlives an optimistic success
+	bool IsRequestLive() const { return !bStopping && (bAttemptActive || bConfigRefreshActive); }
+	// The XRDM/token chain also outlives an attempt that a warm start already completed
+	bool IsAuthChainLive() const { return !bStopping && (bAttemptActive || bSessionRefreshActive); }
+	void LogStage(const TCHAR* Stage);
 	
 	FAbxrAuthCallbacks Callbacks;
 	TWeakObjectPtr<UXRDMService> XRDMService;
 	FThreadSafeBool bStopping{false};
 	FThreadSafeBool bAttemptActive{false};
 	FHttpRequestPtr ActiveRequest;
+	FThreadSafeBool bConfigRefreshActive{false};
+	FHttpRequestPtr ConfigRequest;
+
+	// Last-known server config, loaded from disk once and replaced by every fresh fetch
+	TOptional<FAbxrConfigPayload> CachedConfig;
+	// The session and config files are read once per run, on a worker
+	bool bDiskCacheLoadStarted = false;
+	// Set while running on a token restored from disk, until the server has accepted it or a fresh one replaced it
+	bool bWarmStarted = false;
+	// Set while the auth chain fetches this launch's own token behind a warm start
+	FThreadSafeBool bSessionRefreshActive{false};
+	// Set when a rejected warm start hands the attempt back to the token request; the app has already been told it succeeded
+	bool bSuccessReported = false;
+
+	// Startup timing, reported per stage
+	double AttemptStartSeconds = 0.0;
+	double StageStartSeconds = 0.0;
 
-	bool bAuthenticated;
+	FThreadSafeBool bAuthenticated;
 	FAbxrAuthResponse ResponseData;
+	// Token and Secret are read from the data worker thread when it signs requests
+	mutable FCriticalSection CredentialsLock;
 	
 	FAbxrAuthPayload Payload;
-	int TokenExpiry;
+	int64 TokenExpiry;
 	
 	FTSTicker::FDelegateHandle ReAuthTickHandle;
-	double NextReAuthCheckAtSeconds = 0.0;
+	FDelegateHandle ForegroundHandle;
 	
 	FTSTicker::FDelegateHandle RetryTickHandle;
 	static constexpr int RetryMaxAttempts = 3;
 	static constexpr int RetryDelaySeconds = 1;
 
-	static constexpr double ReAuthPollSeconds = 30.0;
+	static constexpr float ReAuthBusyRetrySeconds = 30.0f;
 	static constexpr int32 ReAuthThresholdSeconds = 120;
 };
@@ -9,12 +9,22 @@ UAbxrSettings::UAbxrSettings()
 	EnableAutomaticTelemetry = true;
 	HeadsetControllerTracking = true;
 	PositionCapturePeriodSeconds = 1;
+	PoseTrackCapture = false;
+	PoseTrackSeconds = 5;
+	PoseCaptureRateHz = 30;
+	PositionEpsilonCm = 0.5;
+	RotationEpsilonDegrees = 0.5;
+	MemoryDeltaMB = 16.0;
+	BatteryDeltaPercent = 1.0;
+	ThreadTimeDeltaMs = 1.0;
+	TelemetryHeartbeatSeconds = 60.0;
+	TelemetryFrameBudgetMicroseconds = 500;
 	EnableSceneEvents = true;
 	EnableAutoStartAuth = true;
 	AuthenticationStartDelay = 0;
 	EnableAutoStartModules = true;
 	EnableAutoAdvanceModules = true;
-	FrameRateTrackingPeriodSeconds = 0.5f;
+	FrameRateTrackingPeriodSeconds = 10.0f;
 	TelemetryTrackingPeriodSeconds = 10;
 	SendRetriesOnFailure = 3;
 	SendRetryIntervalSeconds = 3;
@@ -23,9 +33,14 @@ UAbxrSettings::UAbxrSettings()
 	MaxCallFrequencySeconds = 1;
 	DataEntriesPerSendAttempt = 32;
 	StorageEntriesPerSendAttempt = 16;
+	MaxInFlightRequests = 2;
+	DataCompression = EAbxrDataCompression::None;
+	DataCommonMeta = false;
 	PruneSentItemsOlderThanHours = 12;
 	MaximumCachedItems = 1024;
 	RetainLocalAfterSent = false;
+	IngestQueueCapacity = 1024;
+	IngestOverflowPolicy = EAbxrQueueOverflowPolicy::DropOldest;
 }
 
 bool UAbxrSettings::IsValid() const
@@ -108,6 +123,14 @@ bool UAbxrSettings::IsValid() const
         return false;
     }
 
+    if (MaxInFlightRequests < 1 || MaxInFlightRequests > 8)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "MaxInFlightRequests must be between 1 and 8, got %s"),
+                                    *FString::FromInt(MaxInFlightRequests));
+        return false;
+    }
+
     if (PruneSentItemsOlderThanHours < 0 || PruneSentItemsOlderThanHours > 8760) // Max 1 year
     {
         UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
@@ -124,6 +147,14 @@ bool UAbxrSettings::IsValid() const
         return false;
     }
 
+    if (IngestQueueCapacity < 16 || IngestQueueCapacity > 65536)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "IngestQueueCapacity must be between 16 and 65536, got %s"),
+                                    *FString::FromInt(IngestQueueCapacity));
+        return false;
+    }
+
     /*if (MaxDictionarySize < 5 || MaxDictionarySize > 1000)
     {
         UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
@@ -140,6 +171,38 @@ bool UAbxrSettings::IsValid() const
         return false;
     }
 
+    if (PoseTrackSeconds < 1 || PoseTrackSeconds > 60)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "PoseTrackSeconds must be between 1 and 60, got %s"),
+                                    *FString::FromInt(PoseTrackSeconds));
+        return false;
+    }
+
+    if (PoseCaptureRateHz < 1 || PoseCaptureRateHz > 120)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "PoseCaptureRateHz must be between 1 and 120, got %s"),
+                                    *FString::FromInt(PoseCaptureRateHz));
+        return false;
+    }
+
+    if (TelemetryFrameBudgetMicroseconds < 50 || TelemetryFrameBudgetMicroseconds > 10000)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "TelemetryFrameBudgetMicroseconds must be between 50 and 10000, got %s"),
+                                    *FString::FromInt(TelemetryFrameBudgetMicroseconds));
+        return false;
+    }
+
+    if (TelemetryHeartbeatSeconds < 1.0 || TelemetryHeartbeatSeconds > 3600.0)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
+                                    "TelemetryHeartbeatSeconds must be between 1 and 3600, got %s"),
+                                    *LexToString(TelemetryHeartbeatSeconds));
+        return false;
+    }
+
     if (FrameRateTrackingPeriodSeconds < 0.1f || FrameRateTrackingPeriodSeconds > 60.0f)
     {
         UE_LOG(LogAbxrLib, Error, TEXT("Configuration validation failed - "
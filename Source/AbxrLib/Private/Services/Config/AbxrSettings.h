@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
 #include "UI/AbxrWidget.h"
+#include "Types/AbxrTypes.h"
 #include "UObject/SoftObjectPtr.h"
 #include "AbxrSettings.generated.h"
 
@@ -35,10 +36,56 @@ public:
 	bool HeadsetControllerTracking;
 	void SetHeadsetControllerTracking(const bool NewHeadsetControllerTracking) {this->HeadsetControllerTracking = NewHeadsetControllerTracking;}
 
+	// How often the "Player Location" and "Player Rotation" entries are sampled
 	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Position Capture Period (seconds)"))
 	int PositionCapturePeriodSeconds;
 	void SetPositionCapturePeriodSeconds(const int NewPositionCapturePeriodSeconds) {this->PositionCapturePeriodSeconds = NewPositionCapturePeriodSeconds;}
 
+	// Also sends HMD and controller poses as binary "Pose Track" entries; needs a backend that reads the APT1 format
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Pose Track Capture"))
+	bool PoseTrackCapture;
+	void SetPoseTrackCapture(const bool NewPoseTrackCapture) {this->PoseTrackCapture = NewPoseTrackCapture;}
+
+	// Length of each uploaded pose track; poses are sampled at Pose Capture Rate in between
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Pose Track Length (seconds)", ClampMin=1, ClampMax=60))
+	int PoseTrackSeconds;
+	void SetPoseTrackSeconds(const int NewPoseTrackSeconds) {this->PoseTrackSeconds = NewPoseTrackSeconds;}
+
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Pose Capture Rate (Hz)", ClampMin=1, ClampMax=120))
+	int PoseCaptureRateHz;
+	void SetPoseCaptureRateHz(const int NewPoseCaptureRateHz) {this->PoseCaptureRateHz = NewPoseCaptureRateHz;}
+
+	// Dead-band thresholds: a sample is only sent once its channel has changed by at least this much
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Position Epsilon (cm)", ClampMin=0))
+	double PositionEpsilonCm;
+	void SetPositionEpsilonCm(const double NewPositionEpsilonCm) {this->PositionEpsilonCm = NewPositionEpsilonCm;}
+
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Rotation Epsilon (degrees)", ClampMin=0))
+	double RotationEpsilonDegrees;
+	void SetRotationEpsilonDegrees(const double NewRotationEpsilonDegrees) {this->RotationEpsilonDegrees = NewRotationEpsilonDegrees;}
+
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Memory Delta (MB)", ClampMin=0))
+	double MemoryDeltaMB;
+	void SetMemoryDeltaMB(const double NewMemoryDeltaMB) {this->MemoryDeltaMB = NewMemoryDeltaMB;}
+
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Battery Delta (%)", ClampMin=0))
+	double BatteryDeltaPercent;
+	void SetBatteryDeltaPercent(const double NewBatteryDeltaPercent) {this->BatteryDeltaPercent = NewBatteryDeltaPercent;}
+
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Thread Time Delta (ms)", ClampMin=0))
+	double ThreadTimeDeltaMs;
+	void SetThreadTimeDeltaMs(const double NewThreadTimeDeltaMs) {this->ThreadTimeDeltaMs = NewThreadTimeDeltaMs;}
+
+	// Time telemetry captures may take per frame; captures past it wait for the next frame
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Telemetry Frame Budget (microseconds)"))
+	int TelemetryFrameBudgetMicroseconds;
+	void SetTelemetryFrameBudgetMicroseconds(const int NewTelemetryFrameBudgetMicroseconds) {this->TelemetryFrameBudgetMicroseconds = NewTelemetryFrameBudgetMicroseconds;}
+
+	// A channel that has not changed is still sampled at least this often
+	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Telemetry Heartbeat (seconds)"))
+	double TelemetryHeartbeatSeconds;
+	void SetTelemetryHeartbeatSeconds(const double NewTelemetryHeartbeatSeconds) {this->TelemetryHeartbeatSeconds = NewTelemetryHeartbeatSeconds;}
+
 	UPROPERTY(EditAnywhere, Config, Category="Player Tracking", meta=(DisplayName="Enable Scene Events"))
 	bool EnableSceneEvents;
 	void SetEnableSceneEvents(const bool NewEnableSceneEvents) {this->EnableSceneEvents = NewEnableSceneEvents;}
@@ -80,6 +127,7 @@ public:
 	double TelemetryTrackingPeriodSeconds;
 	void SetTelemetryTrackingPeriodSeconds(const double NewTelemetryTrackingPeriodSeconds) {this->TelemetryTrackingPeriodSeconds = NewTelemetryTrackingPeriodSeconds;}
 
+	// Every frame is measured; this is how often a min/avg/max, percentile and hitch summary is sent
 	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Frame Rate Tracking Period (seconds)"))
 	double FrameRateTrackingPeriodSeconds;
 	void SetFrameRateTrackingPeriodSeconds(const double NewFrameRateTrackingPeriodSeconds) {this->FrameRateTrackingPeriodSeconds = NewFrameRateTrackingPeriodSeconds;}
@@ -112,6 +160,22 @@ public:
 	int StorageEntriesPerSendAttempt;
 	void SetStorageEntriesPerSendAttempt(const int NewStorageEntriesPerSendAttempt) {this->StorageEntriesPerSendAttempt = NewStorageEntriesPerSendAttempt;}
 
+	// How many data POSTs may be outstanding at once while a backlog is draining
+	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Max In-Flight Requests"))
+	int MaxInFlightRequests;
+	void SetMaxInFlightRequests(const int NewMaxInFlightRequests) {this->MaxInFlightRequests = NewMaxInFlightRequests;}
+
+	// Content-Encoding applied to data upload bodies; the server config can turn this on per app
+	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Data Compression"))
+	EAbxrDataCompression DataCompression;
+	void SetDataCompression(const EAbxrDataCompression NewDataCompression) {this->DataCompression = NewDataCompression;}
+
+	// Send super metadata and module info once per batch in a "commonMeta" section instead of inside every entry.
+	// Requires a backend that understands the section.
+	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Batch Common Metadata"))
+	bool DataCommonMeta;
+	void SetDataCommonMeta(const bool NewDataCommonMeta) {this->DataCommonMeta = NewDataCommonMeta;}
+
 	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Prune Sent Items Older Than Hours"))
 	int PruneSentItemsOlderThanHours;
 	void SetPruneSentItemsOlderThanHours(const int NewPruneSentItemsOlderThanHours) {this->PruneSentItemsOlderThanHours = NewPruneSentItemsOlderThanHours;}
@@ -123,4 +187,14 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Retain Local After Sent"))
 	bool RetainLocalAfterSent;
 	void SetRetainLocalAfterSent(const bool NewRetainLocalAfterSent) {this->RetainLocalAfterSent = NewRetainLocalAfterSent;}
+
+	// Size of the lock-free queue that hands entries from any thread to the data service
+	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Ingest Queue Capacity"))
+	int IngestQueueCapacity;
+	void SetIngestQueueCapacity(const int NewIngestQueueCapacity) {this->IngestQueueCapacity = NewIngestQueueCapacity;}
+
+	// What to do when the ingest queue is full
+	UPROPERTY(EditAnywhere, Config, Category="Network Configuration", meta=(DisplayName="Ingest Queue Overflow Policy"))
+	EAbxrQueueOverflowPolicy IngestOverflowPolicy;
+	void SetIngestOverflowPolicy(const EAbxrQueueOverflowPolicy NewIngestOverflowPolicy) {this->IngestOverflowPolicy = NewIngestOverflowPolicy;}
 };
@@ -0,0 +1,312 @@
+#include "AbxrDataEncoder.h"
+
+void FAbxrDataEncoder::Encode(const TConstArrayView<FAbxrDataEntry> Entries, TArray<uint8>& Out, const bool bCommonMeta)
+{
+	Out.Reset(FMath::Max(LastBodySize, 64));
+	CommonMeta.Reset();
+	EntryCommonIndex.Reset();
+	CommonIndexByPointer.Reset();
+	CommonIndexByHash.Reset();
+	BodyHasher.Reset();
+	HashedBytes = 0;
+
+	WriteRaw(Out, "{");
+	if (bCommonMeta)
+	{
+		EntryCommonIndex.Reserve(Entries.Num());
+		for (const FAbxrDataEntry& Entry : Entries)
+		{
+			const bool bShared = Entry.SharedMeta.IsValid() && Entry.SharedMeta->Num() > 0;
+			EntryCommonIndex.Add(bShared ? FindOrAddCommonMeta(*Entry.SharedMeta) : INDEX_NONE);
+		}
+		WriteRaw(Out, "\"commonMeta\":[");
+		for (int32 i = 0; i < CommonMeta.Num(); ++i)
+		{
+			if (i > 0) Out.Add(',');
+			WriteCommonMeta(Out, *CommonMeta[i]);
+		}
+		WriteRaw(Out, "],");
+	}
+
+	// Same key order as FAbxrDataPayloadWrapper; empty sections are still written
+	WriteSection(Out, "\"event\":[", Entries, EAbxrDataKind::Event);
+	WriteSection(Out, "],\"telemetry\":[", Entries, EAbxrDataKind::Telemetry);
+	WriteSection(Out, "],\"basicLog\":[", Entries, EAbxrDataKind::Log);
+	WriteRaw(Out, "]}");
+	HashWritten(Out);
+
+	LastBodySize = Out.Num();
+}
+
+int32 FAbxrDataEncoder::FindOrAddCommonMeta(const TArray<FAbxrMetaPair>& Meta)
+{
+	if (const int32* Found = CommonIndexByPointer.Find(&Meta)) return *Found;
+
+	// Journal replay gives every entry its own copy of the snapshot; equal contents still share one index
+	const uint32 Hash = HashMeta(Meta);
+	int32 Index = INDEX_NONE;
+	for (auto It = CommonIndexByHash.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		if (MetaEquals(*CommonMeta[It.Value()], Meta))
+		{
+			Index = It.Value();
+			break;
+		}
+	}
+	if (Index == INDEX_NONE)
+	{
+		Index = CommonMeta.Add(&Meta);
+		CommonIndexByHash.Add(Hash, Index);
+	}
+	CommonIndexByPointer.Add(&Meta, Index);
+	return Index;
+}
+
+uint32 FAbxrDataEncoder::HashMeta(const TArray<FAbxrMetaPair>& Meta)
+{
+	uint32 Hash = 0;
+	for (const FAbxrMetaPair& Pair : Meta)
+	{
+		Hash = HashCombineFast(Hash, HashCombineFast(GetTypeHash(Pair.Key), GetTypeHash(Pair.Value)));
+	}
+	return Hash;
+}
+
+bool FAbxrDataEncoder::MetaEquals(const TArray<FAbxrMetaPair>& A, const TArray<FAbxrMetaPair>& B)
+{
+	if (A.Num() != B.Num()) return false;
+	for (int32 i = 0; i < A.Num(); ++i)
+	{
+		if (A[i].Key != B[i].Key || !A[i].Value.Equals(B[i].Value, ESearchCase::CaseSensitive)) return false;
+	}
+	return true;
+}
+
+void FAbxrDataEncoder::HashWritten(const TArray<uint8>& Out)
+{
+	BodyHasher.Update(Out.GetData() + HashedBytes, Out.Num() - HashedBytes);
+	HashedBytes = Out.Num();
+}
+
+void FAbxrDataEncoder::WriteSection(TArray<uint8>& Out, const ANSICHAR* Name, const TConstArrayView<FAbxrDataEntry> Entries, const EAbxrDataKind Kind)
+{
+	WriteRaw(Out, Name);
+	bool bFirst = true;
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const FAbxrDataEntry& Entry = Entries[i];
+		if (Entry.Kind != Kind) continue;
+		if (!bFirst) Out.Add(',');
+		bFirst = false;
+		WriteEntry(Out, Entry, EntryCommonIndex.IsValidIndex(i) ? EntryCommonIndex[i] : INDEX_NONE);
+		if (Out.Num() - HashedBytes >= HashBlockBytes) HashWritten(Out);
+	}
+}
+
+void FAbxrDataEncoder::WriteEntry(TArray<uint8>& Out, const FAbxrDataEntry& Entry, const int32 CommonIndex) const
+{
+	WriteRaw(Out, "{\"preciseTimestamp\":\"");
+	WriteInt(Out, Entry.TimestampMs);
+	Out.Add('"');
+	if (Entry.Kind == EAbxrDataKind::Log)
+	{
+		WriteRaw(Out, ",\"logLevel\":");
+		WriteString(Out, Entry.LogLevel.ToString());
+		WriteRaw(Out, ",\"text\":");
+		WriteString(Out, Entry.Text);
+	}
+	else
+	{
+		WriteRaw(Out, ",\"name\":");
+		WriteString(Out, Entry.Name.ToString());
+	}
+	WriteRaw(Out, ",\"meta\":");
+	WriteMeta(Out, Entry, CommonIndex == INDEX_NONE);
+	if (CommonIndex != INDEX_NONE)
+	{
+		WriteRaw(Out, ",\"commonMeta\":");
+		WriteInt(Out, CommonIndex);
+	}
+	Out.Add('}');
+}
+
+void FAbxrDataEncoder::WriteMeta(TArray<uint8>& Out, const FAbxrDataEntry& Entry, const bool bInlineShared)
+{
+	static const FAbxrAtom SceneNameKey(TEXT("Scene Name"));
+
+	// Same precedence the subsystem used to apply when it merged everything into one TMap:
+	// the record's own fields and meta, then the scene, then module info and super metadata.
+	// FString == is case-insensitive, like the TMap keys were.
+	const auto IsShadowed = [&Entry](const FString& Key)
+	{
+		if (Key == SceneNameKey.ToString()) return true;
+		for (const FAbxrTelemetryField& Field : Entry.Fields)
+		{
+			if (Key == Field.Key.ToString()) return true;
+		}
+		for (const FAbxrMetaPair& Pair : Entry.Meta)
+		{
+			if (Key == Pair.Key.ToString()) return true;
+		}
+		return false;
+	};
+
+	Out.Add('{');
+	for (const FAbxrTelemetryField& Field : Entry.Fields)
+	{
+		WriteField(Out, Field);
+		Out.Add(',');
+	}
+	for (const FAbxrMetaPair& Pair : Entry.Meta)
+	{
+		// The current scene always wins over a caller-supplied one
+		if (Pair.Key.ToString() == SceneNameKey.ToString()) continue;
+		WritePair(Out, Pair);
+		Out.Add(',');
+	}
+	WriteString(Out, SceneNameKey.ToString());
+	Out.Add(':');
+	WriteString(Out, Entry.Scene.ToString());
+	if (bInlineShared && Entry.SharedMeta.IsValid())
+	{
+		for (const FAbxrMetaPair& Pair : *Entry.SharedMeta)
+		{
+			if (IsShadowed(Pair.Key.ToString())) continue;
+			Out.Add(',');
+			WritePair(Out, Pair);
+		}
+	}
+	Out.Add('}');
+}
+
+void FAbxrDataEncoder::WriteCommonMeta(TArray<uint8>& Out, const TArray<FAbxrMetaPair>& Meta)
+{
+	Out.Add('{');
+	for (int32 i = 0; i < Meta.Num(); ++i)
+	{
+		if (i > 0) Out.Add(',');
+		WritePair(Out, Meta[i]);
+	}
+	Out.Add('}');
+}
+
+void FAbxrDataEncoder::WritePair(TArray<uint8>& Out, const FAbxrMetaPair& Pair)
+{
+	WriteString(Out, Pair.Key.ToString());
+	Out.Add(':');
+	WriteString(Out, Pair.Value);
+}
+
+void FAbxrDataEncoder::WriteField(TArray<uint8>& Out, const FAbxrTelemetryField& Field)
+{
+	WriteString(Out, Field.Key.ToString());
+	WriteRaw(Out, ":\"");
+	if (Field.Format == EAbxrTelemetryFormat::Integer)
+	{
+		WriteInt(Out, static_cast<int64>(Field.Value));
+	}
+	else
+	{
+		ANSICHAR Buffer[64];
+		const int32 Len = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%f", Field.Value);
+		Out.Append(reinterpret_cast<const uint8*>(Buffer), FMath::Clamp(Len, 0, static_cast<int32>(UE_ARRAY_COUNT(Buffer)) - 1));
+	}
+	WriteEscaped(Out, Field.Unit.ToString());
+	Out.Add('"');
+}
+
+void FAbxrDataEncoder::WriteString(TArray<uint8>& Out, const FString& Value)
+{
+	Out.Add('"');
+	WriteEscaped(Out, Value);
+	Out.Add('"');
+}
+
+void FAbxrDataEncoder::WriteEscaped(TArray<uint8>& Out, const FString& Value)
+{
+	static constexpr ANSICHAR HexDigits[] = "0123456789abcdef";
+
+	const TCHAR* Chars = *Value;
+	const int32 Len = Value.Len();
+	int32 i = 0;
+	while (i < Len)
+	{
+		// Copy runs of plain ASCII in one go; that is nearly every key and value we send
+		int32 RunEnd = i;
+		while (RunEnd < Len && Chars[RunEnd] >= 0x20 && Chars[RunEnd] < 0x80 && Chars[RunEnd] != '"' && Chars[RunEnd] != '\\') ++RunEnd;
+		if (RunEnd > i)
+		{
+			uint8* Dest = Out.GetData() + Out.AddUninitialized(RunEnd - i);
+			for (int32 j = i; j < RunEnd; ++j) *Dest++ = static_cast<uint8>(Chars[j]);
+			i = RunEnd;
+			if (i == Len) break;
+		}
+
+		uint32 Code = static_cast<uint32>(Chars[i++]);
+		switch (Code)
+		{
+		case '"':  WriteRaw(Out, "\\\""); continue;
+		case '\\': WriteRaw(Out, "\\\\"); continue;
+		case '\n': WriteRaw(Out, "\\n"); continue;
+		case '\r': WriteRaw(Out, "\\r"); continue;
+		case '\t': WriteRaw(Out, "\\t"); continue;
+		case '\b': WriteRaw(Out, "\\b"); continue;
+		case '\f': WriteRaw(Out, "\\f"); continue;
+		default: break;
+		}
+
+		if (Code < 0x20)
+		{
+			const uint8 Escape[] = { '\\', 'u', '0', '0', static_cast<uint8>(HexDigits[Code >> 4]), static_cast<uint8>(HexDigits[Code & 0xF]) };
+			Out.Append(Escape, UE_ARRAY_COUNT(Escape));
+			continue;
+		}
+
+		// Combine UTF-16 surrogate pairs; a lone surrogate becomes U+FFFD like the engine's converter
+		if (Code >= 0xD800 && Code <= 0xDBFF && i < Len && Chars[i] >= 0xDC00 && Chars[i] <= 0xDFFF)
+		{
+			Code = 0x10000 + ((Code - 0xD800) << 10) + (static_cast<uint32>(Chars[i++]) - 0xDC00);
+		}
+		else if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF)
+		{
+			Code = 0xFFFD;
+		}
+
+		if (Code < 0x800)
+		{
+			const uint8 Bytes[] = { static_cast<uint8>(0xC0 | (Code >> 6)), static_cast<uint8>(0x80 | (Code & 0x3F)) };
+			Out.Append(Bytes, 2);
+		}
+		else if (Code < 0x10000)
+		{
+			const uint8 Bytes[] = { static_cast<uint8>(0xE0 | (Code >> 12)), static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)), static_cast<uint8>(0x80 | (Code & 0x3F)) };
+			Out.Append(Bytes, 3);
+		}
+		else
+		{
+			const uint8 Bytes[] = { static_cast<uint8>(0xF0 | (Code >> 18)), static_cast<uint8>(0x80 | ((Code >> 12) & 0x3F)), static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F)), static_cast<uint8>(0x80 | (Code & 0x3F)) };
+			Out.Append(Bytes, 4);
+		}
+	}
+}
+
+void FAbxrDataEncoder::WriteInt(TArray<uint8>& Out, const int64 Value)
+{
+	uint8 Digits[20];
+	int32 Count = 0;
+	uint64 Magnitude = Value < 0 ? 0 - static_cast<uint64>(Value) : static_cast<uint64>(Value);
+	do
+	{
+		Digits[Count++] = static_cast<uint8>('0' + Magnitude % 10);
+		Magnitude /= 10;
+	}
+	while (Magnitude != 0);
+
+	if (Value < 0) Out.Add('-');
+	while (Count > 0) Out.Add(Digits[--Count]);
+}
+
+void FAbxrDataEncoder::WriteRaw(TArray<uint8>& Out, const ANSICHAR* Text)
+{
+	Out.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+}
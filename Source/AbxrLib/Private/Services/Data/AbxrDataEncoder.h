@@ -0,0 +1,56 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Types/AbxrTypes.h"
+#include "Util/AbxrCrc32.h"
+
+/**
+ * Writes the /v1/collect/data body straight to UTF-8 bytes.
+ * Produces the same document as running FAbxrDataPayloadWrapper through FJsonObjectConverter,
+ * without the reflection walk, the intermediate FJsonObject tree or the UTF-16 round trip.
+ *
+ * With bCommonMeta, each distinct shared meta snapshot in the batch (by content, so copies replayed
+ * from the journal still collapse into one) is written once to a leading "commonMeta" array and entries refer to it by index ("commonMeta": N next to "meta").
+ * The entry's own meta takes precedence over the referenced keys.
+ *
+ * The body's CRC32 is taken while it is written, a few KB behind the write position while the bytes are still in cache,
+ * so signing an uncompressed body needs no second pass over it.
+ */
+class FAbxrDataEncoder
+{
+public:
+	// Replaces the contents of Out with the encoded entries
+	void Encode(TConstArrayView<FAbxrDataEntry> Entries, TArray<uint8>& Out, bool bCommonMeta = false);
+	// CRC32 of the body produced by the last Encode
+	uint32 GetBodyCRC() const { return BodyHasher.Get(); }
+
+private:
+	void WriteSection(TArray<uint8>& Out, const ANSICHAR* Name, TConstArrayView<FAbxrDataEntry> Entries, EAbxrDataKind Kind);
+	void HashWritten(const TArray<uint8>& Out);
+	void WriteEntry(TArray<uint8>& Out, const FAbxrDataEntry& Entry, int32 CommonIndex) const;
+	int32 FindOrAddCommonMeta(const TArray<FAbxrMetaPair>& Meta);
+	static uint32 HashMeta(const TArray<FAbxrMetaPair>& Meta);
+	static bool MetaEquals(const TArray<FAbxrMetaPair>& A, const TArray<FAbxrMetaPair>& B);
+	static void WriteMeta(TArray<uint8>& Out, const FAbxrDataEntry& Entry, bool bInlineShared);
+	static void WriteCommonMeta(TArray<uint8>& Out, const TArray<FAbxrMetaPair>& Meta);
+	static void WritePair(TArray<uint8>& Out, const FAbxrMetaPair& Pair);
+	static void WriteField(TArray<uint8>& Out, const FAbxrTelemetryField& Field);
+	static void WriteString(TArray<uint8>& Out, const FString& Value);
+	static void WriteEscaped(TArray<uint8>& Out, const FString& Value);
+	static void WriteInt(TArray<uint8>& Out, int64 Value);
+	static void WriteRaw(TArray<uint8>& Out, const ANSICHAR* Text);
+
+	// Size of the previous body, used to size the next one up front
+	int32 LastBodySize = 0;
+	// Shared meta snapshots written to the current body's "commonMeta" section, in index order
+	TArray<const TArray<FAbxrMetaPair>*> CommonMeta;
+	// "commonMeta" index of each entry being encoded, INDEX_NONE for entries that inline theirs
+	TArray<int32> EntryCommonIndex;
+	// Entries recorded in the same run share one snapshot, so most lookups stop at the pointer
+	TMap<const TArray<FAbxrMetaPair>*, int32> CommonIndexByPointer;
+	TMultiMap<uint32, int32> CommonIndexByHash;
+
+	FAbxrCrc32Hasher BodyHasher;
+	int32 HashedBytes = 0;
+	// Large enough that the hardware CRC path runs on full blocks, small enough to still be in L1/L2
+	static constexpr int32 HashBlockBytes = 4096;
+};
@@ -0,0 +1,441 @@
+#include "AbxrDataJournal.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Services/Config/AbxrSettings.h"
+#include "Types/AbxrLog.h"
+
+// Every record is framed as [uint32 PayloadSize][uint32 PayloadCrc][payload] so a torn tail can be detected on replay
+static constexpr int32 RecordHeaderSize = sizeof(uint32) * 2;
+
+static void SealRecord(TArray<uint8>& Bytes, int32 Offset)
+{
+	const uint32 PayloadSize = static_cast<uint32>(Bytes.Num() - Offset - RecordHeaderSize);
+	const uint32 PayloadCrc = FCrc::MemCrc32(Bytes.GetData() + Offset + RecordHeaderSize, PayloadSize);
+	FMemory::Memcpy(Bytes.GetData() + Offset, &PayloadSize, sizeof(uint32));
+	FMemory::Memcpy(Bytes.GetData() + Offset + sizeof(uint32), &PayloadCrc, sizeof(uint32));
+}
+
+FAbxrDataJournal::FAbxrDataJournal()
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FAbxrDataJournal::~FAbxrDataJournal()
+{
+	Close();
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+bool FAbxrDataJournal::Open(const FString& InDirectory, TArray<FAbxrDataEntry>& OutReplayed)
+{
+	if (bOpen) return true;
+
+	Directory = InDirectory;
+	bRetainSent = GetDefault<UAbxrSettings>()->RetainLocalAfterSent;
+	PruneSentOlderThanHours = GetDefault<UAbxrSettings>()->PruneSentItemsOlderThanHours;
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.MakeDirectory(*Directory, true))
+	{
+		UE_LOG(LogAbxrLib, Error, TEXT("Unable to create data journal directory '%s'"), *Directory);
+		return false;
+	}
+
+	TArray<FString> FileNames;
+	FileManager.FindFiles(FileNames, *Directory, TEXT("abxj"));
+
+	TArray<TPair<uint64, FString>> FoundSegments;
+	for (const FString& FileName : FileNames)
+	{
+		const uint64 Id = FCString::Strtoui64(*FPaths::GetBaseFilename(FileName), nullptr, 10);
+		FoundSegments.Emplace(Id, FPaths::Combine(Directory, FileName));
+	}
+	FoundSegments.Sort([](const TPair<uint64, FString>& A, const TPair<uint64, FString>& B) { return A.Key < B.Key; });
+
+	TMap<uint64, FAbxrDataEntry> Entries;
+	TArray<TArray<uint64>> SegmentSeqs;
+	TSet<uint64> Acked;
+	uint64 MaxSeq = 0;
+	for (const TPair<uint64, FString>& Found : FoundSegments)
+	{
+		NextSegmentId = FMath::Max(NextSegmentId, Found.Key + 1);
+		TArray<uint64> Seqs;
+		if (!ReadSegment(Found.Value, Entries, Seqs, Acked, MaxSeq))
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Discarding unreadable data journal segment '%s'"), *Found.Value);
+			RetireFile(Found.Value);
+			continue;
+		}
+		Segments.AddDefaulted_GetRef().Path = Found.Value;
+		SegmentSeqs.Add(MoveTemp(Seqs));
+	}
+
+	// Old segments are kept as they are and retired like any other once their unsent entries are acknowledged.
+	// Each run writes its entries in order into its own segments, so every segment covers a disjoint range of Seqs.
+	for (int32 i = 0; i < Segments.Num(); ++i)
+	{
+		FSegment& Segment = Segments[i];
+		for (const uint64 Seq : SegmentSeqs[i])
+		{
+			Segment.FirstSeq = FMath::Min(Segment.FirstSeq, Seq);
+			Segment.LastSeq = FMath::Max(Segment.LastSeq, Seq);
+			if (!Acked.Contains(Seq)) ++Segment.Entries;
+		}
+	}
+
+	for (TPair<uint64, FAbxrDataEntry>& Pair : Entries)
+	{
+		if (!Acked.Contains(Pair.Key)) OutReplayed.Add(MoveTemp(Pair.Value));
+	}
+	OutReplayed.Sort([](const FAbxrDataEntry& A, const FAbxrDataEntry& B) { return A.Seq < B.Seq; });
+
+	{
+		FScopeLock Lock(&PendingLock);
+		NextSeq = MaxSeq + 1;
+	}
+
+	RetireCompletedSegments();
+	PruneSentFiles();
+
+	bStopping = false;
+	Thread = FRunnableThread::Create(this, TEXT("AbxrDataJournal"), 0, TPri_BelowNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogAbxrLib, Error, TEXT("Unable to start data journal writer thread"));
+		return false;
+	}
+	bOpen = true;
+
+	if (OutReplayed.Num() > 0)
+	{
+		UE_LOG(LogAbxrLib, Log, TEXT("Replayed %d unsent entries from the data journal"), OutReplayed.Num());
+	}
+	return true;
+}
+
+void FAbxrDataJournal::Close()
+{
+	if (!Thread) return;
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+	bOpen = false;
+
+	if (ActiveFile)
+	{
+		ActiveFile->Flush(true);
+		delete ActiveFile;
+		ActiveFile = nullptr;
+	}
+}
+
+void FAbxrDataJournal::Append(FAbxrDataEntry& Entry)
+{
+	if (!bOpen) return;
+	FScopeLock Lock(&PendingLock);
+	if (Entry.Seq == 0) Entry.Seq = NextSeq++;
+	BufferEntry(Entry);
+}
+
+void FAbxrDataJournal::Acknowledge(const TConstArrayView<uint64> Seqs)
+{
+	if (!bOpen || Seqs.Num() == 0) return;
+
+	FScopeLock Lock(&PendingLock);
+	FPendingRecord& Record = PendingRecords.AddDefaulted_GetRef();
+	Record.Offset = PendingBytes.Num();
+	Record.AckedSeqs = TArray<uint64>(Seqs.GetData(), Seqs.Num());
+
+	PendingBytes.AddZeroed(RecordHeaderSize);
+	FMemoryWriter Writer(PendingBytes, true, true);
+	uint8 Type = static_cast<uint8>(ERecordType::Ack);
+	Writer << Type << Record.AckedSeqs;
+	SealRecord(PendingBytes, Record.Offset);
+	Record.Size = PendingBytes.Num() - Record.Offset;
+}
+
+void FAbxrDataJournal::Flush()
+{
+	if (WakeEvent) WakeEvent->Trigger();
+}
+
+uint32 FAbxrDataJournal::Run()
+{
+	while (!bStopping)
+	{
+		WakeEvent->Wait(FlushIntervalMs);
+		WritePending();
+	}
+
+	WritePending();
+	return 0;
+}
+
+void FAbxrDataJournal::Stop()
+{
+	bStopping = true;
+	if (WakeEvent) WakeEvent->Trigger();
+}
+
+void FAbxrDataJournal::BufferEntry(FAbxrDataEntry& Entry)
+{
+	FPendingRecord& Record = PendingRecords.AddDefaulted_GetRef();
+	Record.Offset = PendingBytes.Num();
+	Record.Seq = Entry.Seq;
+
+	if (Entry.SharedMeta.IsValid() && Entry.SharedMeta->Num() > 0)
+	{
+		if (Entry.SharedMeta != LastSharedMeta)
+		{
+			LastSharedMeta = Entry.SharedMeta;
+			++LastSharedMetaId;
+		}
+		Record.SharedMetaId = LastSharedMetaId;
+		Record.SharedMeta = Entry.SharedMeta;
+	}
+
+	PendingBytes.AddZeroed(RecordHeaderSize);
+	FMemoryWriter Writer(PendingBytes, true, true);
+	uint8 Type = static_cast<uint8>(ERecordType::Entry);
+	Writer << Type << Entry << Record.SharedMetaId;
+	SealRecord(PendingBytes, Record.Offset);
+	Record.Size = PendingBytes.Num() - Record.Offset;
+}
+
+void FAbxrDataJournal::WritePending()
+{
+	TArray<uint8> Bytes;
+	TArray<FPendingRecord> Records;
+	{
+		FScopeLock Lock(&PendingLock);
+		if (PendingRecords.Num() == 0) return;
+		Swap(Bytes, PendingBytes);
+		Swap(Records, PendingRecords);
+	}
+
+	// A failed write stops the batch; what follows is lost rather than written out of order
+	for (const FPendingRecord& Record : Records)
+	{
+		if ((!ActiveFile || Segments.Last().Bytes >= MaxSegmentBytes) && !RollSegment())
+		{
+			break;
+		}
+
+		if (Record.SharedMetaId != 0 && !SegmentSharedMetaIds.Contains(Record.SharedMetaId) && !WriteSharedMeta(Record))
+		{
+			break;
+		}
+
+		if (!ActiveFile->Write(Bytes.GetData() + Record.Offset, Record.Size))
+		{
+			UE_LOG(LogAbxrLib, Error, TEXT("Failed to write to data journal segment '%s'"), *Segments.Last().Path);
+			break;
+		}
+
+		FSegment& Segment = Segments.Last();
+		Segment.Bytes += Record.Size;
+		if (Record.Seq != 0)
+		{
+			++Segment.Entries;
+			Segment.FirstSeq = FMath::Min(Segment.FirstSeq, Record.Seq);
+			Segment.LastSeq = FMath::Max(Segment.LastSeq, Record.Seq);
+		}
+		for (const uint64 Seq : Record.AckedSeqs) MarkAcked(Seq);
+	}
+
+	// One sync per batch rather than per record
+	if (ActiveFile) ActiveFile->Flush(true);
+
+	RetireCompletedSegments();
+
+	// Hand the buffer back so its capacity is reused by the next batch
+	FScopeLock Lock(&PendingLock);
+	if (PendingBytes.Num() == 0)
+	{
+		Bytes.Reset();
+		Swap(PendingBytes, Bytes);
+	}
+}
+
+bool FAbxrDataJournal::WriteSharedMeta(const FPendingRecord& Record)
+{
+	SharedMetaBytes.Reset();
+	SharedMetaBytes.AddZeroed(RecordHeaderSize);
+	FMemoryWriter Writer(SharedMetaBytes, true, true);
+	uint8 Type = static_cast<uint8>(ERecordType::SharedMeta);
+	uint32 Id = Record.SharedMetaId;
+	// The snapshot is immutable once published, so reading it here needs no lock
+	TArray<FAbxrMetaPair>& Pairs = const_cast<TArray<FAbxrMetaPair>&>(*Record.SharedMeta);
+	Writer << Type << Id << Pairs;
+	SealRecord(SharedMetaBytes, 0);
+
+	if (!ActiveFile->Write(SharedMetaBytes.GetData(), SharedMetaBytes.Num()))
+	{
+		UE_LOG(LogAbxrLib, Error, TEXT("Failed to write to data journal segment '%s'"), *Segments.Last().Path);
+		return false;
+	}
+	Segments.Last().Bytes += SharedMetaBytes.Num();
+	SegmentSharedMetaIds.Add(Id);
+	return true;
+}
+
+bool FAbxrDataJournal::RollSegment()
+{
+	if (ActiveFile)
+	{
+		ActiveFile->Flush(true);
+		delete ActiveFile;
+		ActiveFile = nullptr;
+		PruneSentFiles();
+	}
+
+	const FString Path = MakeSegmentPath(NextSegmentId++);
+	ActiveFile = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path);
+	if (!ActiveFile)
+	{
+		UE_LOG(LogAbxrLib, Error, TEXT("Unable to open data journal segment '%s'"), *Path);
+		return false;
+	}
+
+	const uint32 Header[2] = { SegmentMagic, SegmentVersion };
+	ActiveFile->Write(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+
+	FSegment& Segment = Segments.AddDefaulted_GetRef();
+	Segment.Path = Path;
+	Segment.Bytes = sizeof(Header);
+	// Snapshot ids are only valid within the segment that defines them
+	SegmentSharedMetaIds.Reset();
+	return true;
+}
+
+void FAbxrDataJournal::MarkAcked(const uint64 Seq)
+{
+	for (FSegment& Segment : Segments)
+	{
+		if (Segment.Entries > 0 && Seq >= Segment.FirstSeq && Seq <= Segment.LastSeq)
+		{
+			++Segment.Acked;
+			return;
+		}
+	}
+}
+
+void FAbxrDataJournal::RetireCompletedSegments()
+{
+	// Retire strictly oldest-first (and never the active segment) so an ack record is never
+	// removed while the entry it refers to is still on disk
+	while (Segments.Num() > (ActiveFile ? 1 : 0) && Segments[0].Acked >= Segments[0].Entries)
+	{
+		RetireFile(Segments[0].Path);
+		Segments.RemoveAt(0);
+	}
+}
+
+void FAbxrDataJournal::RetireFile(const FString& Path) const
+{
+	if (bRetainSent)
+	{
+		IFileManager::Get().Move(*FPaths::ChangeExtension(Path, TEXT("sent")), *Path);
+	}
+	else
+	{
+		IFileManager::Get().Delete(*Path);
+	}
+}
+
+void FAbxrDataJournal::PruneSentFiles() const
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *Directory, TEXT("sent"));
+
+	const FDateTime Cutoff = FDateTime::UtcNow() - FTimespan::FromHours(PruneSentOlderThanHours);
+	for (const FString& FileName : FileNames)
+	{
+		const FString Path = FPaths::Combine(Directory, FileName);
+		if (IFileManager::Get().GetTimeStamp(*Path) < Cutoff) IFileManager::Get().Delete(*Path);
+	}
+}
+
+FString FAbxrDataJournal::MakeSegmentPath(const uint64 Id) const
+{
+	return FPaths::Combine(Directory, FString::Printf(TEXT("%020llu.abxj"), Id));
+}
+
+bool FAbxrDataJournal::ReadSegment(const FString& Path, TMap<uint64, FAbxrDataEntry>& Entries, TArray<uint64>& SegmentSeqs, TSet<uint64>& Acked, uint64& MaxSeq)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path)) return false;
+
+	uint32 Header[2] = { 0, 0 };
+	if (Data.Num() < static_cast<int32>(sizeof(Header))) return false;
+	FMemory::Memcpy(Header, Data.GetData(), sizeof(Header));
+	if (Header[0] != SegmentMagic || Header[1] != SegmentVersion) return false;
+
+	// One shared array per snapshot id, as they were shared in memory when written
+	TMap<uint32, FAbxrSharedMetaPtr> SharedMetas;
+	int64 Offset = sizeof(Header);
+	while (Offset + RecordHeaderSize <= Data.Num())
+	{
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+		FMemory::Memcpy(&PayloadSize, Data.GetData() + Offset, sizeof(uint32));
+		FMemory::Memcpy(&PayloadCrc, Data.GetData() + Offset + sizeof(uint32), sizeof(uint32));
+
+		// A short or corrupt record means the app died mid-write; everything before it is still good
+		const uint8* Payload = Data.GetData() + Offset + RecordHeaderSize;
+		if (PayloadSize == 0 || Offset + RecordHeaderSize + PayloadSize > Data.Num()) break;
+		if (FCrc::MemCrc32(Payload, PayloadSize) != PayloadCrc) break;
+
+		FMemoryReaderView Reader(MakeArrayView(Payload, PayloadSize), true);
+		uint8 Type = 0;
+		Reader << Type;
+		if (Type == static_cast<uint8>(ERecordType::Entry))
+		{
+			FAbxrDataEntry Entry;
+			uint32 SharedMetaId = 0;
+			Reader << Entry << SharedMetaId;
+			if (!Reader.IsError())
+			{
+				Entry.SharedMeta = SharedMetas.FindRef(SharedMetaId);
+				MaxSeq = FMath::Max(MaxSeq, Entry.Seq);
+				SegmentSeqs.Add(Entry.Seq);
+				Entries.Add(Entry.Seq, MoveTemp(Entry));
+			}
+		}
+		else if (Type == static_cast<uint8>(ERecordType::SharedMeta))
+		{
+			uint32 Id = 0;
+			TArray<FAbxrMetaPair> Pairs;
+			Reader << Id << Pairs;
+			if (!Reader.IsError()) SharedMetas.Add(Id, MakeShared<TArray<FAbxrMetaPair>, ESPMode::ThreadSafe>(MoveTemp(Pairs)));
+		}
+		else if (Type == static_cast<uint8>(ERecordType::Ack))
+		{
+			TArray<uint64> Seqs;
+			Reader << Seqs;
+			for (const uint64 Seq : Seqs)
+			{
+				MaxSeq = FMath::Max(MaxSeq, Seq);
+				Acked.Add(Seq);
+			}
+		}
+
+		Offset += RecordHeaderSize + PayloadSize;
+	}
+
+	return true;
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Types/AbxrTypes.h"
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+/**
+ * Append-only, segment-based on-disk journal for queued data entries.
+ * Entries and acknowledgements are buffered in memory and written by a background thread that
+ * fsyncs once per batch, so callers never wait on storage. Segments whose entries have all been
+ * acknowledged are deleted (or kept as *.sent when RetainLocalAfterSent is enabled).
+ * Each shared meta snapshot is written once per segment and referenced by id from its entries.
+ */
+class FAbxrDataJournal : public FRunnable
+{
+public:
+	FAbxrDataJournal();
+	virtual ~FAbxrDataJournal() override;
+
+	// Reads unacknowledged entries left by previous runs and starts the writer thread. Reads every segment, so call it
+	// off the game thread. The old segments stay on disk until the entries replayed from them are acknowledged.
+	bool Open(const FString& InDirectory, TArray<FAbxrDataEntry>& OutReplayed);
+	// Writes everything still buffered and stops the writer thread
+	void Close();
+
+	// Assigns Entry.Seq (if not already set) and buffers the entry for the next write; does nothing unless Open succeeded
+	void Append(FAbxrDataEntry& Entry);
+	// Marks entries as sent (or dropped) so they are not replayed on the next start
+	void Acknowledge(TConstArrayView<uint64> Seqs);
+	// Wakes the writer thread so buffered records are written and synced right away
+	void Flush();
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	enum class ERecordType : uint8
+	{
+		Entry = 1,
+		Ack = 2,
+		SharedMeta = 3
+	};
+
+	struct FSegment
+	{
+		FString Path;
+		int64 Bytes = 0;
+		uint64 FirstSeq = MAX_uint64;
+		uint64 LastSeq = 0;
+		int32 Entries = 0;
+		int32 Acked = 0;
+	};
+
+	struct FPendingRecord
+	{
+		int32 Offset = 0;
+		int32 Size = 0;
+		uint64 Seq = 0;
+		TArray<uint64> AckedSeqs;
+		// Written ahead of the entry the first time the id appears in a segment
+		uint32 SharedMetaId = 0;
+		FAbxrSharedMetaPtr SharedMeta;
+	};
+
+	void BufferEntry(FAbxrDataEntry& Entry);
+	void WritePending();
+	bool WriteSharedMeta(const FPendingRecord& Record);
+	bool RollSegment();
+	void MarkAcked(uint64 Seq);
+	void RetireCompletedSegments();
+	void RetireFile(const FString& Path) const;
+	void PruneSentFiles() const;
+	FString MakeSegmentPath(uint64 Id) const;
+	static bool ReadSegment(const FString& Path, TMap<uint64, FAbxrDataEntry>& Entries, TArray<uint64>& SegmentSeqs, TSet<uint64>& Acked, uint64& MaxSeq);
+
+	FString Directory;
+	bool bRetainSent = false;
+	int32 PruneSentOlderThanHours = 0;
+
+	// Guarded by PendingLock
+	FCriticalSection PendingLock;
+	TArray<uint8> PendingBytes;
+	TArray<FPendingRecord> PendingRecords;
+	uint64 NextSeq = 1;
+	// Entries nearly always carry the current snapshot, so only the last one is remembered; holding it keeps its address from being reused
+	FAbxrSharedMetaPtr LastSharedMeta;
+	uint32 LastSharedMetaId = 0;
+
+	// Set by Open; Append and Acknowledge come from the same thread
+	bool bOpen = false;
+
+	// Owned by the writer thread
+	TArray<FSegment> Segments;
+	TSet<uint32> SegmentSharedMetaIds;
+	TArray<uint8> SharedMetaBytes;
+	IFileHandle* ActiveFile = nullptr;
+	uint64 NextSegmentId = 1;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopping{false};
+
+	static constexpr uint32 SegmentMagic = 0x4A585241; // "ARXJ"
+	static constexpr uint32 SegmentVersion = 4;
+	static constexpr int64 MaxSegmentBytes = 256 * 1024;
+	static constexpr uint32 FlushIntervalMs = 500;
+};
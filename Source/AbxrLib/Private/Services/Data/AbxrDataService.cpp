@@ -1,146 +1,486 @@
 #include "AbxrDataService.h"
 #include "Services/Config/AbxrSettings.h"
-#include "HttpModule.h"
-#include "JsonObjectConverter.h"
 #include "Util/AbxrUtil.h"
+#include "Util/AbxrCrc32.h"
+#include "Services/Transport/AbxrHttpTransport.h"
 #include "Interfaces/IHttpResponse.h"
+#include "HAL/PlatformProcess.h"
 #include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
 #include "Types/AbxrLog.h"
+#include "Misc/Compression.h"
+#include "Misc/Paths.h"
 
-bool FAbxrDataService::Tick(float /*DeltaTime*/)
+FAbxrDataService::FAbxrDataService(FAbxrAuthService& AuthService) :
+	AuthService(AuthService),
+	IngestRing(GetDefault<UAbxrSettings>()->IngestQueueCapacity),
+	JitterStream(static_cast<int32>(FPlatformTime::Cycles())),
+	LastCallTime(0),
+	NextAt(0)
 {
-	if (FPlatformTime::Seconds() >= NextAt) Send();
-	return true;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FAbxrDataService::~FAbxrDataService()
+{
+	Shutdown();
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+static FAbxrDataSendSettings MakeSendSettings()
+{
+	const UAbxrSettings* Config = GetDefault<UAbxrSettings>();
+	FAbxrDataSendSettings Out;
+	Out.RestUrl = Config->RestUrl;
+	Out.MaxCallFrequencySeconds = Config->MaxCallFrequencySeconds;
+	Out.SendNextBatchWaitSeconds = Config->SendNextBatchWaitSeconds;
+	Out.SendRetryIntervalSeconds = Config->SendRetryIntervalSeconds;
+	Out.SendRetriesOnFailure = Config->SendRetriesOnFailure;
+	Out.DataEntriesPerSendAttempt = Config->DataEntriesPerSendAttempt;
+	Out.StorageEntriesPerSendAttempt = Config->StorageEntriesPerSendAttempt;
+	Out.MaximumCachedItems = Config->MaximumCachedItems;
+	Out.MaxInFlightRequests = Config->MaxInFlightRequests;
+	Out.DataCompression = Config->DataCompression;
+	Out.bCommonMeta = Config->DataCommonMeta;
+	return Out;
 }
 
 void FAbxrDataService::Start()
 {
-	if (bStarted) return;
-	NextAt = FPlatformTime::Seconds() + GetDefault<UAbxrSettings>()->SendNextBatchWaitSeconds;
-	Ticker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAbxrDataService::Tick), 0.25f);
-	bStarted = true;
+	if (Thread) return;
+	check(IsInGameThread());
+
+	Settings = MakeSendSettings();
+	// Opened by the worker; reading the previous run's segments must not hold up the game thread
+	if (!Journal) Journal = MakeUnique<FAbxrDataJournal>();
+	NextAt = FPlatformTime::Seconds() + Settings.SendNextBatchWaitSeconds;
+
+	bStopping = false;
+	bRunning = true;
+	Thread = FRunnableThread::Create(this, TEXT("AbxrDataService"), 0, TPri_BelowNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogAbxrLib, Error, TEXT("Failed to start the data service worker thread"));
+		bRunning = false;
+	}
+}
+
+void FAbxrDataService::Shutdown()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+	bRunning = false;
+	if (Journal) Journal->Close();
+}
+
+uint32 FAbxrDataService::Run()
+{
+	OpenJournal();
+
+	while (!bStopping)
+	{
+		WakeEvent->Wait(WorkerIntervalMs);
+		if (bStopping) break;
+
+		ApplySettings();
+		DrainIngest();
+		DrainCompletions();
+
+		const bool bForce = bForceSendRequested.AtomicSet(false);
+		if (bForce || bSendRequested || FPlatformTime::Seconds() >= NextAt)
+		{
+			bSendRequested = false;
+			SendNow(bForce);
+		}
+	}
+
+	// Whatever is still in the ring gets journaled so it survives the shutdown
+	DrainIngest();
+	return 0;
+}
+
+void FAbxrDataService::OpenJournal()
+{
+	// Before the first drain, so replayed entries stay ahead of anything recorded since launch
+	TArray<FAbxrDataEntry> Replayed;
+	if (!Journal->Open(GetJournalDirectory(), Replayed))
+	{
+		UE_LOG(LogAbxrLib, Warning, TEXT("Data journal unavailable; queued data will not survive a restart"));
+		return;
+	}
+	Backlog = MoveTemp(Replayed);
+	StoredRemaining = Backlog.Num();
+	EnforceCacheLimit();
 }
 
 void FAbxrDataService::Stop()
 {
-	if (!bStarted) return;
-	bStarted = false;
-	if (Ticker.IsValid())
+	bStopping = true;
+	if (WakeEvent) WakeEvent->Trigger();
+}
+
+void FAbxrDataService::Send(const bool bForce)
+{
+	if (bForce) bForceSendRequested = true;
+	else bSendRequested = true;
+	if (WakeEvent) WakeEvent->Trigger();
+}
+
+void FAbxrDataService::FlushStorage() const
+{
+	if (Journal) Journal->Flush();
+}
+
+void FAbxrDataService::RefreshSettings()
+{
 	{
-		FTSTicker::GetCoreTicker().RemoveTicker(Ticker);
-		Ticker.Reset();
+		FScopeLock Lock(&SettingsLock);
+		PendingSettings = MakeSendSettings();
 	}
+	bSettingsDirty = true;
+}
+
+void FAbxrDataService::ApplySettings()
+{
+	if (!bSettingsDirty.AtomicSet(false)) return;
+	FScopeLock Lock(&SettingsLock);
+	Settings = PendingSettings;
+}
+
+FString FAbxrDataService::GetJournalDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbxrLib"), TEXT("Journal"));
 }
 
-static FString MakePreciseTimestamp()
+static int64 MakePreciseTimestamp()
 {
 	const FDateTime Now = FDateTime::UtcNow();
-	const int64 UnixMillis = Now.ToUnixTimestamp() * 1000 + Now.GetMillisecond();
-	return FString::Printf(TEXT("%lld"), UnixMillis);
+	return Now.ToUnixTimestamp() * 1000 + Now.GetMillisecond();
+}
+
+void FAbxrDataService::AddEvent(const FAbxrAtom Name, const TMap<FString, FString>& Meta, const FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta)
+{
+	FAbxrDataEntry Entry;
+	Entry.Kind = EAbxrDataKind::Event;
+	Entry.TimestampMs = MakePreciseTimestamp();
+	Entry.Name = Name;
+	Entry.Scene = Scene;
+	Entry.Meta = FAbxrMetaPair::FromMap(Meta);
+	Entry.SharedMeta = SharedMeta;
+	Enqueue(MoveTemp(Entry));
+}
+
+void FAbxrDataService::AddTelemetry(const FAbxrAtom Name, const TMap<FString, FString>& Meta, const FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta)
+{
+	FAbxrDataEntry Entry;
+	Entry.Kind = EAbxrDataKind::Telemetry;
+	Entry.TimestampMs = MakePreciseTimestamp();
+	Entry.Name = Name;
+	Entry.Scene = Scene;
+	Entry.Meta = FAbxrMetaPair::FromMap(Meta);
+	Entry.SharedMeta = SharedMeta;
+	Enqueue(MoveTemp(Entry));
+}
+
+void FAbxrDataService::AddTypedTelemetry(const FAbxrAtom Name, const TConstArrayView<FAbxrTelemetryField> Fields, const FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta)
+{
+	FAbxrDataEntry Entry;
+	Entry.Kind = EAbxrDataKind::Telemetry;
+	Entry.TimestampMs = MakePreciseTimestamp();
+	Entry.Name = Name;
+	Entry.Scene = Scene;
+	Entry.Fields.Append(Fields.GetData(), Fields.Num());
+	Entry.SharedMeta = SharedMeta;
+	Enqueue(MoveTemp(Entry));
+}
+
+void FAbxrDataService::AddLog(const FAbxrAtom Level, const FString& Text, const TMap<FString, FString>& Meta, const FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta)
+{
+	FAbxrDataEntry Entry;
+	Entry.Kind = EAbxrDataKind::Log;
+	Entry.TimestampMs = MakePreciseTimestamp();
+	Entry.LogLevel = Level;
+	Entry.Scene = Scene;
+	Entry.Text = Text;
+	Entry.Meta = FAbxrMetaPair::FromMap(Meta);
+	Entry.SharedMeta = SharedMeta;
+	Enqueue(MoveTemp(Entry));
 }
 
-void FAbxrDataService::AddEvent(const FString& Name, const TMap<FString, FString>& Meta)
+void FAbxrDataService::Enqueue(FAbxrDataEntry&& Entry)
 {
-	FAbxrEventPayload Payload;
-	Payload.preciseTimestamp = MakePreciseTimestamp();
-	Payload.name = Name;
-	Payload.meta = Meta;
+	EAbxrQueueOverflowPolicy Policy = GetDefault<UAbxrSettings>()->IngestOverflowPolicy;
+	// Nobody is draining the ring before Start or after Shutdown, so blocking would never return
+	if (Policy == EAbxrQueueOverflowPolicy::Block && !bRunning) Policy = EAbxrQueueOverflowPolicy::DropOldest;
+	IngestRing.Push(MoveTemp(Entry), Policy);
 
-	FScopeLock Lock(&Mutex);
-	EventPayloads.Add(Payload);
-	if (EventPayloads.Num() + TelemetryPayloads.Num() + LogPayloads.Num() >=
-		GetDefault<UAbxrSettings>()->DataEntriesPerSendAttempt)
+	if (IngestRing.Num() >= GetDefault<UAbxrSettings>()->DataEntriesPerSendAttempt)
 	{
-		NextAt = FPlatformTime::Seconds();
+		bSendRequested = true;
+		WakeEvent->Trigger();
 	}
 }
 
-void FAbxrDataService::AddTelemetry(const FString& Name, const TMap<FString, FString>& Meta)
+void FAbxrDataService::DrainIngest()
 {
-	FAbxrTelemetryPayload Payload;
-	Payload.preciseTimestamp = MakePreciseTimestamp();
-	Payload.name = Name;
-	Payload.meta = Meta;
+	FAbxrDataEntry Entry;
+	bool bDrained = false;
+	while (IngestRing.TryDequeue(Entry))
+	{
+		if (Journal) Journal->Append(Entry);
+		Backlog.Add(MoveTemp(Entry));
+		bDrained = true;
+	}
+	if (bDrained)
+	{
+		// The first entries after a quiet spell will go out within SendNextBatchWaitSeconds; open the connection meanwhile
+		if (InFlightRequests == 0 && AuthService.Authenticated())
+		{
+			FAbxrHttpTransport::Get().Prewarm(FAbxrUtil::CombineUrl(Settings.RestUrl, TEXT("/v1/collect/data")));
+		}
+		EnforceCacheLimit();
+		if (BacklogNum() >= Settings.DataEntriesPerSendAttempt) bSendRequested = true;
+	}
 
-	FScopeLock Lock(&Mutex);
-	TelemetryPayloads.Add(Payload);
-	if (EventPayloads.Num() + TelemetryPayloads.Num() + LogPayloads.Num() >=
-		GetDefault<UAbxrSettings>()->DataEntriesPerSendAttempt)
+	const FAbxrIngestStats Stats = IngestRing.GetStats();
+	if (Stats.Dropped != ReportedDrops)
 	{
-		NextAt = FPlatformTime::Seconds();
+		UE_LOG(LogAbxrLib, Warning, TEXT("Ingest queue overflowed; %lld entries dropped so far (capacity %d, high-water mark %d)"),
+			Stats.Dropped, Stats.Capacity, Stats.HighWaterMark);
+		ReportedDrops = Stats.Dropped;
 	}
 }
 
-void FAbxrDataService::AddLog(const FString& Level, const FString& Text, const TMap<FString, FString>& Meta)
+void FAbxrDataService::EnforceCacheLimit()
 {
-	FAbxrLogPayload Payload;
-	Payload.preciseTimestamp = MakePreciseTimestamp();
-	Payload.logLevel = Level;
-	Payload.text = Text;
-	Payload.meta = Meta;
+	const int32 Overflow = BacklogNum() - Settings.MaximumCachedItems;
+	if (Overflow < 0 && bAtCacheLimit)
+	{
+		UE_LOG(LogAbxrLib, Log, TEXT("Backlog is below MaximumCachedItems again; %lld oldest queued entries were dropped while at the limit"), CacheLimitDrops);
+		bAtCacheLimit = false;
+		CacheLimitDrops = 0;
+	}
+	if (Overflow <= 0) return;
 
-	FScopeLock Lock(&Mutex);
-	LogPayloads.Add(Payload);
-	if (EventPayloads.Num() + TelemetryPayloads.Num() + LogPayloads.Num() >=
-		GetDefault<UAbxrSettings>()->DataEntriesPerSendAttempt)
+	// Oldest entries go first; acknowledging them keeps them from being replayed on the next start
+	TArray<uint64> Dropped;
+	Dropped.Reserve(Overflow);
+	for (int32 i = 0; i < Overflow; ++i)
 	{
-		NextAt = FPlatformTime::Seconds();
+		FAbxrDataEntry& Entry = Backlog[BacklogHead + i];
+		Dropped.Add(Entry.Seq);
+		Entry = FAbxrDataEntry();
+	}
+	BacklogHead += Overflow;
+	StoredRemaining = FMath::Max(0, StoredRemaining - Overflow);
+	CompactBacklog();
+
+	if (Journal) Journal->Acknowledge(Dropped);
+	CacheLimitDrops += Overflow;
+	// Drains run every few hundred ms while the backend is unreachable, so only the first drop is worth a warning
+	if (!bAtCacheLimit)
+	{
+		UE_LOG(LogAbxrLib, Warning, TEXT("MaximumCachedItems (%d) reached; dropping the oldest queued entries until the backlog drains"), Settings.MaximumCachedItems);
+		bAtCacheLimit = true;
 	}
 }
 
-void FAbxrDataService::Send(const bool bForce)
+void FAbxrDataService::CompactBacklog()
+{
+	// The consumed prefix is only reclaimed once it is at least half the array, which keeps taking chunks off the front amortized O(1)
+	if (BacklogHead == 0 || BacklogHead * 2 < Backlog.Num()) return;
+	Backlog.RemoveAt(0, BacklogHead);
+	BacklogHead = 0;
+}
+
+void FAbxrDataService::SendNow(const bool bForce)
 {
 	const int64 UnixSeconds = FDateTime::UtcNow().ToUnixTimestamp();
-	if (!bForce && UnixSeconds - LastCallTime < GetDefault<UAbxrSettings>()->MaxCallFrequencySeconds) return;
+	if (!bForce && UnixSeconds - LastCallTime < Settings.MaxCallFrequencySeconds) return;
 	LastCallTime = UnixSeconds;
-	NextAt = FPlatformTime::Seconds() + GetDefault<UAbxrSettings>()->SendNextBatchWaitSeconds;
+	NextAt = FPlatformTime::Seconds() + Settings.SendNextBatchWaitSeconds;
+
+	DispatchChunks();
+}
+
+void FAbxrDataService::DrainCompletions()
+{
+	FCompletion Completion;
+	while (CompletionQueue.Dequeue(Completion))
+	{
+		OnChunkComplete(MoveTemp(Completion.Chunk), Completion.bSucceeded);
+	}
+}
+
+void FAbxrDataService::DispatchChunks()
+{
 	if (!AuthService.Authenticated()) return;
 
-	TArray<FAbxrEventPayload> EventsToSend;
-	TArray<FAbxrTelemetryPayload> TelemetriesToSend;
-	TArray<FAbxrLogPayload> LogsToSend;
+	const double Now = FPlatformTime::Seconds();
+	if (Now < BackoffUntil) return;
+	if (CircuitState == EAbxrSendCircuitState::Open)
 	{
-		FScopeLock Lock(&Mutex);
-		if (EventPayloads.Num() == 0 && TelemetryPayloads.Num() == 0 && LogPayloads.Num() == 0) return;
-		EventsToSend = MoveTemp(EventPayloads);
-		TelemetriesToSend = MoveTemp(TelemetryPayloads);
-		LogsToSend = MoveTemp(LogPayloads);
+		UE_LOG(LogAbxrLib, Log, TEXT("Data send circuit half-open; probing with a single request"));
+		CircuitState = EAbxrSendCircuitState::HalfOpen;
 	}
 
-	FAbxrDataPayloadWrapper Wrapper;
-	Wrapper.event = EventsToSend;
-	Wrapper.telemetry = TelemetriesToSend;
-	Wrapper.basicLog = LogsToSend;
+	++DispatchRound;
+
+	// While half-open only one probe goes out; the rest waits for its verdict
+	const int32 MaxInFlight = CircuitState == EAbxrSendCircuitState::HalfOpen ? 1 : Settings.MaxInFlightRequests;
+
+	// Failed chunks go first, already encoded; then entries replayed from storage, StorageEntriesPerSendAttempt at a time
+	FAbxrDataChunk Chunk;
+	while (InFlightRequests < MaxInFlight && RetryQueue.Dequeue(Chunk))
+	{
+		--RetryChunks;
+		SendChunk(MoveTemp(Chunk));
+	}
+	while (InFlightRequests < MaxInFlight && BacklogNum() > 0)
+	{
+		Chunk = FAbxrDataChunk();
+		Chunk.bFromStorage = StoredRemaining > 0;
+		const int32 Count = Chunk.bFromStorage
+			? FMath::Min(StoredRemaining, Settings.StorageEntriesPerSendAttempt)
+			: FMath::Min(BacklogNum(), Settings.DataEntriesPerSendAttempt);
+		Chunk.Entries.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i) Chunk.Entries.Add(MoveTemp(Backlog[BacklogHead + i]));
+		BacklogHead += Count;
+		if (Chunk.bFromStorage) StoredRemaining -= Count;
+		SendChunk(MoveTemp(Chunk));
+	}
+	CompactBacklog();
+}
 
-	FString Json;
-	FJsonObjectConverter::UStructToJsonObjectString(FAbxrDataPayloadWrapper::StaticStruct(), &Wrapper, Json, 0, 0, 0, nullptr, false);
+void FAbxrDataService::SendChunk(FAbxrDataChunk&& Chunk)
+{
+	if (Chunk.Body.IsEmpty())
+	{
+		Encoder.Encode(Chunk.Entries, Chunk.Body, Settings.bCommonMeta);
+		Chunk.BodyCRC = Encoder.GetBodyCRC();
+		Chunk.bCompressed = CompressBody(Chunk.Body);
+		// The hash covers the bytes on the wire, so a compressed body needs its own pass
+		if (Chunk.bCompressed) Chunk.BodyCRC = FAbxrCrc32::Compute(Chunk.Body.GetData(), Chunk.Body.Num());
+	}
 
-	const FString Url = FAbxrUtil::CombineUrl(GetDefault<UAbxrSettings>()->RestUrl, TEXT("/v1/collect/data"));
-	const TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("POST"));
+	Chunk.DispatchRound = DispatchRound;
+	const FString Url = FAbxrUtil::CombineUrl(Settings.RestUrl, TEXT("/v1/collect/data"));
+	const TSharedRef<IHttpRequest> Request = FAbxrHttpTransport::Get().CreateRequest(TEXT("POST"), Url);
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	Request->SetContentAsString(Json);
-	AuthService.SetAuthHeaders(Request, Json);
+	if (Chunk.bCompressed) Request->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+	AuthService.SetAuthHeaders(Request, Chunk.BodyCRC);
+	Request->SetContent(MoveTemp(Chunk.Body));
+	// Completions only post back to the worker, so there is no reason to bounce through the game thread
+	Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
 
 	Request->OnProcessRequestComplete().BindLambda(
-		[EventsToSend, TelemetriesToSend, LogsToSend, DataPtr = AsWeak()](FHttpRequestPtr, const FHttpResponsePtr& Response, const bool bWasSuccessful)
+		[SentChunk = MoveTemp(Chunk), DataPtr = AsWeak()](const FHttpRequestPtr& Req, const FHttpResponsePtr& Response, const bool bWasSuccessful) mutable
 		{
-			if (!bWasSuccessful || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+			FAbxrHttpTransport::Get().RecordCompletion(Req);
+			const bool bSucceeded = bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+			if (bSucceeded)
+			{
+				UE_LOG(LogAbxrLib, Log, TEXT("Data POST successful: %s"), *Response->GetContentAsString());
+			}
+			else
 			{
-				const TSharedPtr<FAbxrDataService> Self = DataPtr.Pin();
-				if (!Self) return;
-				UE_LOG(LogAbxrLib, Error, TEXT("Data POST failed: %s"), *Response->GetContentAsString());
-				{
-					FScopeLock Lock(&Self->Mutex);
-					Self->EventPayloads.Insert(EventsToSend, 0);
-					Self->TelemetryPayloads.Insert(TelemetriesToSend, 0);
-					Self->LogPayloads.Insert(LogsToSend, 0);
-				}
-				Self->NextAt = FPlatformTime::Seconds() + GetDefault<UAbxrSettings>()->SendRetryIntervalSeconds;
-				return;
+				UE_LOG(LogAbxrLib, Error, TEXT("Data POST failed: %s"), Response.IsValid() ? *Response->GetContentAsString() : TEXT("<no response>"));
+				// Keep the encoded body so the retry does not have to rebuild it
+				if (Req.IsValid()) SentChunk.Body = Req->GetContent();
+			}
+			if (const TSharedPtr<FAbxrDataService> Self = DataPtr.Pin())
+			{
+				Self->CompletionQueue.Enqueue({MoveTemp(SentChunk), bSucceeded});
+				Self->WakeEvent->Trigger();
 			}
-			UE_LOG(LogAbxrLib, Log, TEXT("Data POST successful: %s"), *Response->GetContentAsString());
 		});
-	Request->ProcessRequest();
+	++InFlightRequests;
+	FAbxrHttpTransport::Get().ProcessRequest(Request);
+}
+
+bool FAbxrDataService::CompressBody(TArray<uint8>& Body) const
+{
+	if (Settings.DataCompression != EAbxrDataCompression::Gzip || Body.Num() < MinCompressBytes) return false;
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Body.Num());
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num()) || CompressedSize >= Body.Num())
+	{
+		return false;
+	}
+	Compressed.SetNum(CompressedSize);
+	Body = MoveTemp(Compressed);
+	return true;
+}
+
+void FAbxrDataService::OnChunkComplete(FAbxrDataChunk&& Chunk, const bool bSucceeded)
+{
+	--InFlightRequests;
+
+	if (!bSucceeded)
+	{
+		const uint64 ChunkRound = Chunk.DispatchRound;
+		RetryQueue.Enqueue(MoveTemp(Chunk));
+		++RetryChunks;
+		OnSendFailed(ChunkRound);
+		return;
+	}
+
+	if (CircuitState != EAbxrSendCircuitState::Closed)
+	{
+		UE_LOG(LogAbxrLib, Log, TEXT("Data send circuit closed; backend reachable again"));
+	}
+	CircuitState = EAbxrSendCircuitState::Closed;
+	ConsecutiveFailures = 0;
+	BackoffUntil = 0;
+
+	if (Journal)
+	{
+		TArray<uint64> Seqs;
+		Seqs.Reserve(Chunk.Entries.Num());
+		for (const FAbxrDataEntry& Entry : Chunk.Entries) Seqs.Add(Entry.Seq);
+		Journal->Acknowledge(Seqs);
+	}
+
+	// Retries, replayed data or a full chunk still waiting means we are draining a backlog; keep the pipe busy
+	if (RetryChunks > 0 || StoredRemaining > 0 || BacklogNum() >= Settings.DataEntriesPerSendAttempt) DispatchChunks();
+}
+
+void FAbxrDataService::OnSendFailed(const uint64 ChunkRound)
+{
+	// Anything sent before the last counted failure is the same outage reporting in again; it is queued for retry but not counted
+	if (ChunkRound <= CountedFailureRound) return;
+	CountedFailureRound = DispatchRound;
+	++ConsecutiveFailures;
+
+	// Exponential backoff from SendRetryIntervalSeconds until SendRetriesOnFailure retries are used up,
+	// then the circuit opens and only a single probe is let through after a long cool-down
+	double Delay;
+	if (CircuitState == EAbxrSendCircuitState::HalfOpen || ConsecutiveFailures > Settings.SendRetriesOnFailure)
+	{
+		if (CircuitState != EAbxrSendCircuitState::Open)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Data send circuit open after %d consecutive failures; pausing uploads"), ConsecutiveFailures);
+		}
+		CircuitState = EAbxrSendCircuitState::Open;
+		Delay = CircuitOpenSeconds;
+	}
+	else
+	{
+		Delay = FMath::Min(static_cast<double>(Settings.SendRetryIntervalSeconds) * FMath::Pow(2.0, ConsecutiveFailures - 1), MaxRetryBackoffSeconds);
+	}
+
+	// Jitter keeps a venue full of headsets from retrying in lockstep after a shared outage
+	BackoffUntil = FMath::Max(BackoffUntil, FPlatformTime::Seconds() + Delay * JitterStream.FRandRange(0.5f, 1.0f));
+	NextAt = FMath::Max(NextAt, BackoffUntil);
 }
@@ -1,36 +1,150 @@
 #pragma once
 #include "CoreMinimal.h"
-#include "Containers/Ticker.h"
+#include "Containers/Queue.h"
 #include "Types/AbxrTypes.h"
 #include "Services/Auth/AbxrAuthService.h"
+#include "Services/Data/AbxrDataEncoder.h"
+#include "Services/Data/AbxrDataJournal.h"
+#include "Services/Data/AbxrIngestRing.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include <atomic>
 
-class FAbxrDataService : public TSharedFromThis<FAbxrDataService>
+class FEvent;
+class FRunnableThread;
+
+// A slice of the backlog that goes out as one POST and is acknowledged on its own
+struct FAbxrDataChunk
+{
+	TArray<FAbxrDataEntry> Entries;
+	TArray<uint8> Body;  // kept across retries so a chunk is only encoded once
+	uint32 BodyCRC = 0;  // of Body as sent, for the request signature
+	bool bCompressed = false;
+	bool bFromStorage = false;
+	uint64 DispatchRound = 0;  // the DispatchChunks call that last sent it
+};
+
+// The UAbxrSettings values the worker thread reads, copied on the game thread by RefreshSettings
+struct FAbxrDataSendSettings
+{
+	FString RestUrl;
+	int32 MaxCallFrequencySeconds = 0;
+	int32 SendNextBatchWaitSeconds = 0;
+	int32 SendRetryIntervalSeconds = 0;
+	int32 SendRetriesOnFailure = 0;
+	int32 DataEntriesPerSendAttempt = 0;
+	int32 StorageEntriesPerSendAttempt = 0;
+	int32 MaximumCachedItems = 0;
+	int32 MaxInFlightRequests = 0;
+	EAbxrDataCompression DataCompression = EAbxrDataCompression::None;
+	bool bCommonMeta = false;
+};
+
+/**
+ * Queues events, telemetry and logs and uploads them to /v1/collect/data.
+ * Callers on any thread only push into the ingest ring. A low-priority worker thread owns everything
+ * after that: journaling, batching, encoding, hashing, request creation and handling completions.
+ */
+class FAbxrDataService : public TSharedFromThis<FAbxrDataService>, public FRunnable
 {
 public:
-	explicit FAbxrDataService(class FAbxrAuthService& AuthService) : AuthService(AuthService), LastCallTime(0), bStarted(false), NextAt(0) { }
+	explicit FAbxrDataService(class FAbxrAuthService& AuthService);
+	virtual ~FAbxrDataService() override;
 
-	void AddEvent(const FString& Name, const TMap<FString, FString>& Meta);
-	void AddTelemetry(const FString& Name, const TMap<FString, FString>& Meta);
-	void AddLog(const FString& Level, const FString& Text, const TMap<FString, FString>& Meta);
+	// Scene and SharedMeta are attached by reference and merged into the meta when the batch is encoded
+	void AddEvent(FAbxrAtom Name, const TMap<FString, FString>& Meta, FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta);
+	void AddTelemetry(FAbxrAtom Name, const TMap<FString, FString>& Meta, FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta);
+	void AddLog(FAbxrAtom Level, const FString& Text, const TMap<FString, FString>& Meta, FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta);
+	// Fields are copied into the entry's inline storage
+	void AddTypedTelemetry(FAbxrAtom Name, TConstArrayView<FAbxrTelemetryField> Fields, FAbxrAtom Scene, const FAbxrSharedMetaPtr& SharedMeta);
 
 	void Start();
-	void Stop();
+	void Shutdown();
+	// Asks the worker to send; bForce skips the MaxCallFrequencySeconds gate
 	void Send(const bool bForce);
 	void Send() { Send(false); }
+	void FlushStorage() const;
+	// Picks up settings changed on the game thread (e.g. by the server config)
+	void RefreshSettings();
+	FAbxrIngestStats GetIngestStats() const { return IngestRing.GetStats(); }
+	EAbxrSendCircuitState GetCircuitState() const { return CircuitState.load(std::memory_order_relaxed); }
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
 
 private:
-	bool Tick(float DeltaTime);
-	
+	struct FCompletion
+	{
+		FAbxrDataChunk Chunk;
+		bool bSucceeded = false;
+	};
+
+	void Enqueue(FAbxrDataEntry&& Entry);
+	void OpenJournal();
+	void ApplySettings();
+	void SendNow(bool bForce);
+	void DrainIngest();
+	void DrainCompletions();
+	void EnforceCacheLimit();
+	void DispatchChunks();
+	void SendChunk(FAbxrDataChunk&& Chunk);
+	void OnChunkComplete(FAbxrDataChunk&& Chunk, bool bSucceeded);
+	void OnSendFailed(uint64 DispatchRound);
+	void CompactBacklog();
+	bool CompressBody(TArray<uint8>& Body) const;
+	int32 BacklogNum() const { return Backlog.Num() - BacklogHead; }
+	static FString GetJournalDirectory();
+
 	FAbxrAuthService& AuthService;
+	// Created in Start and kept until destruction; does nothing if the worker could not open it
+	TUniquePtr<FAbxrDataJournal> Journal;
+
+	// Shared between threads
+	TAbxrIngestRing<FAbxrDataEntry> IngestRing;
+	TQueue<FCompletion, EQueueMode::Mpsc> CompletionQueue;
+	FThreadSafeBool bSendRequested{false};
+	FThreadSafeBool bForceSendRequested{false};
+	std::atomic<EAbxrSendCircuitState> CircuitState{EAbxrSendCircuitState::Closed};
+	FCriticalSection SettingsLock;
+	FAbxrDataSendSettings PendingSettings;
+	FThreadSafeBool bSettingsDirty{false};
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopping{false};
+	FThreadSafeBool bRunning{false};
 
-	FCriticalSection Mutex;
-	TArray<FAbxrEventPayload> EventPayloads;
-	TArray<FAbxrTelemetryPayload> TelemetryPayloads;
-	TArray<FAbxrLogPayload> LogPayloads;
+	// Owned by the worker thread
+	FAbxrDataSendSettings Settings;
+	int64 ReportedDrops = 0;
+	// Entries dropped since the backlog last reached MaximumCachedItems; logged once on the way out
+	bool bAtCacheLimit = false;
+	int64 CacheLimitDrops = 0;
+
+	// Oldest first; entries before BacklogHead have already been handed to a chunk
+	TArray<FAbxrDataEntry> Backlog;
+	int32 BacklogHead = 0;
+	int32 StoredRemaining = 0;  // leading backlog entries replayed from the journal, sent StorageEntriesPerSendAttempt at a time
+	int32 InFlightRequests = 0;
+	FAbxrDataEncoder Encoder;
+
+	// Failed chunks wait here and go out ahead of the backlog; at most MaxInFlightRequests of them
+	TQueue<FAbxrDataChunk> RetryQueue;
+	int32 RetryChunks = 0;
+	int32 ConsecutiveFailures = 0;
+	// Requests sent together fail together; only one failure per DispatchChunks call is counted
+	uint64 DispatchRound = 0;
+	uint64 CountedFailureRound = 0;
+	double BackoffUntil = 0;
+	FRandomStream JitterStream;
 
 	int64 LastCallTime;
-	bool bStarted;
 	double NextAt;
-	FTSTicker::FDelegateHandle Ticker;
+
+	// Bodies smaller than this go out uncompressed; gzip framing outweighs the savings
+	static constexpr int32 MinCompressBytes = 512;
+	static constexpr double MaxRetryBackoffSeconds = 120.0;
+	static constexpr double CircuitOpenSeconds = 300.0;
+	static constexpr uint32 WorkerIntervalMs = 250;
 };
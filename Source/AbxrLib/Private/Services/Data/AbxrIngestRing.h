@@ -0,0 +1,159 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Types/AbxrTypes.h"
+#include <atomic>
+
+/**
+ * Fixed-capacity lock-free ring that hands entries from any thread to a single consumer.
+ * Every slot is preallocated and carries its own sequence number (Vyukov bounded queue), so
+ * producers never take a lock or allocate. Dequeue is safe from any thread as well, which is
+ * what lets a producer evict the oldest slot under EAbxrQueueOverflowPolicy::DropOldest.
+ */
+template <typename T>
+class TAbxrIngestRing
+{
+public:
+	explicit TAbxrIngestRing(const int32 InCapacity)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2)));
+		Mask = Capacity - 1;
+		Slots = MakeUnique<FSlot[]>(Capacity);
+		for (uint32 i = 0; i < Capacity; ++i) Slots[i].Sequence.store(i, std::memory_order_relaxed);
+	}
+
+	~TAbxrIngestRing()
+	{
+		T Discard;
+		while (TryDequeue(Discard)) { }
+	}
+
+	TAbxrIngestRing(const TAbxrIngestRing&) = delete;
+	TAbxrIngestRing& operator=(const TAbxrIngestRing&) = delete;
+
+	// Moves Item into the ring; leaves it untouched and returns false when the ring is full
+	bool TryEnqueue(T& Item)
+	{
+		uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FSlot& Slot = Slots[Pos & Mask];
+			const uint64 Seq = Slot.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = static_cast<int64>(Seq) - static_cast<int64>(Pos);
+			if (Diff == 0)
+			{
+				if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					new (Slot.Storage.GetTypedPtr()) T(MoveTemp(Item));
+					Slot.Sequence.store(Pos + 1, std::memory_order_release);
+					UpdateHighWaterMark(Pos + 1);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool TryDequeue(T& OutItem)
+	{
+		uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FSlot& Slot = Slots[Pos & Mask];
+			const uint64 Seq = Slot.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = static_cast<int64>(Seq) - static_cast<int64>(Pos + 1);
+			if (Diff == 0)
+			{
+				if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					T* Stored = Slot.Storage.GetTypedPtr();
+					OutItem = MoveTemp(*Stored);
+					Stored->~T();
+					Slot.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = DequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Enqueues according to Policy; returns false only when the item itself was dropped
+	bool Push(T&& Item, const EAbxrQueueOverflowPolicy Policy)
+	{
+		if (TryEnqueue(Item)) return true;
+
+		switch (Policy)
+		{
+		case EAbxrQueueOverflowPolicy::DropNewest:
+			Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		case EAbxrQueueOverflowPolicy::DropOldest:
+			{
+				T Discard;
+				do
+				{
+					if (TryDequeue(Discard)) Dropped.fetch_add(1, std::memory_order_relaxed);
+				}
+				while (!TryEnqueue(Item));
+				return true;
+			}
+		case EAbxrQueueOverflowPolicy::Block:
+			while (!TryEnqueue(Item)) FPlatformProcess::Yield();
+			return true;
+		}
+
+		return false;
+	}
+
+	int32 Num() const
+	{
+		const int64 Count = static_cast<int64>(EnqueuePos.load(std::memory_order_relaxed)) - static_cast<int64>(DequeuePos.load(std::memory_order_relaxed));
+		return static_cast<int32>(FMath::Clamp<int64>(Count, 0, Mask + 1));
+	}
+
+	FAbxrIngestStats GetStats() const
+	{
+		FAbxrIngestStats Stats;
+		Stats.Capacity = static_cast<int32>(Mask + 1);
+		Stats.Queued = Num();
+		Stats.HighWaterMark = HighWaterMark.load(std::memory_order_relaxed);
+		Stats.Dropped = static_cast<int64>(Dropped.load(std::memory_order_relaxed));
+		return Stats;
+	}
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{0};
+		TTypeCompatibleBytes<T> Storage;
+	};
+
+	void UpdateHighWaterMark(const uint64 EnqueuedUpTo)
+	{
+		const int32 Size = static_cast<int32>(FMath::Clamp<int64>(static_cast<int64>(EnqueuedUpTo) - static_cast<int64>(DequeuePos.load(std::memory_order_relaxed)), 0, Mask + 1));
+		int32 Current = HighWaterMark.load(std::memory_order_relaxed);
+		while (Size > Current && !HighWaterMark.compare_exchange_weak(Current, Size, std::memory_order_relaxed)) { }
+	}
+
+	TUniquePtr<FSlot[]> Slots;
+	uint64 Mask = 0;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePos{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Dropped{0};
+	std::atomic<int32> HighWaterMark{0};
+};
@@ -9,6 +9,25 @@
 #if PLATFORM_ANDROID
 TWeakObjectPtr<UXRDMService> UXRDMService::ActiveInstance;
 bool UXRDMService::bNativeMethodsRegistered = false;
+
+static const char* const XRDMMethodNames[] = {
+    "getDeviceId",
+    "getDeviceSerial",
+    "getDeviceTitle",
+    "getDeviceTags",
+    "getOrgId",
+    "getOrgTitle",
+    "getOrgSlug",
+    "getMacAddressFixed",
+    "getMacAddressRandom",
+    "getIsAuthenticated",
+    "getAccessToken",
+    "getRefreshToken",
+    "getExpiresDateUtc",
+    "getIsInitialized",
+    "getFingerprint"
+};
+static_assert(UE_ARRAY_COUNT(XRDMMethodNames) == static_cast<int32>(EXRDMMethod::Count), "XRDMMethodNames must match EXRDMMethod");
 #endif
 
 void UXRDMService::BeginDestroy()
@@ -54,6 +73,7 @@ void UXRDMService::Shutdown()
     bConnectionInProgress = false;
     bConnectCallIssued = false;
     bIsConnected = false;
+    ClearAttributes();
 
     if (ConnectionTimeoutHandle.IsValid())
     {
@@ -255,107 +275,182 @@ bool UXRDMService::IsConnected() const
 #if PLATFORM_ANDROID
     return bIsConnected && ServiceWrapper != nullptr;
 #else
-    return false;
+    return bIsConnected;
 #endif
 }
 
-FString UXRDMService::GetDeviceId() const
+FString* FXRDMAttributes::FindString(const EXRDMAttribute Field)
+{
+    switch (Field)
+    {
+    case EXRDMAttribute::DeviceId: return &DeviceId;
+    case EXRDMAttribute::DeviceSerial: return &DeviceSerial;
+    case EXRDMAttribute::DeviceTitle: return &DeviceTitle;
+    case EXRDMAttribute::OrgId: return &OrgId;
+    case EXRDMAttribute::OrgTitle: return &OrgTitle;
+    case EXRDMAttribute::OrgSlug: return &OrgSlug;
+    case EXRDMAttribute::MacAddressFixed: return &MacAddressFixed;
+    case EXRDMAttribute::MacAddressRandom: return &MacAddressRandom;
+    case EXRDMAttribute::Fingerprint: return &Fingerprint;
+    default: return nullptr;
+    }
+}
+
+TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> UXRDMService::GetAttributes() const
+{
+    {
+        FReadScopeLock ReadLock(AttributesLock);
+        if (Attributes.IsValid() && (Attributes->FailedFields == 0 || FPlatformTime::Seconds() < NextAttributeRetrySeconds)) return Attributes;
+    }
+    if (!IsConnected())
+    {
+        FReadScopeLock ReadLock(AttributesLock);
+        return Attributes;
+    }
+    return UpdateAttributes(0);
+}
+
+TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> UXRDMService::UpdateAttributes(const uint32 Fields) const
+{
+    TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Previous;
+    {
+        // Claim the retry slot so concurrent getters keep using the cached values instead of all calling the SDK
+        FWriteScopeLock WriteLock(AttributesLock);
+        Previous = Attributes;
+        const bool bRetryDue = FPlatformTime::Seconds() >= NextAttributeRetrySeconds;
+        if (Fields == 0 && Previous.IsValid() && (Previous->FailedFields == 0 || !bRetryDue)) return Previous;
+        NextAttributeRetrySeconds = FPlatformTime::Seconds() + AttributeRetrySeconds;
+    }
+
+    // Only what failed last time is read again, unless the caller asked for more
+    FXRDMAttributes Fetched = Previous.IsValid() ? *Previous : FXRDMAttributes();
+    const uint32 ToRead = Fields | (Previous.IsValid() ? Previous->FailedFields : FXRDMAttributes::AllFields);
+    Fetched.FailedFields &= ~ToRead;
+    ReadAttributes(Fetched, ToRead);
+
+    TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = MakeShared<FXRDMAttributes, ESPMode::ThreadSafe>(MoveTemp(Fetched));
+    FWriteScopeLock WriteLock(AttributesLock);
+    Attributes = MoveTemp(Snapshot);
+    return Attributes;
+}
+
+void UXRDMService::RefreshAttributes()
+{
+    if (!IsConnected())
+    {
+        ClearAttributes();
+        return;
+    }
+
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = UpdateAttributes(FXRDMAttributes::AllFields);
+    if (Snapshot.IsValid() && Snapshot->FailedFields != 0)
+    {
+        UE_LOG(LogAbxrLib, Warning, TEXT("XRDM attribute read failed for field mask 0x%x; keeping their previous values"), Snapshot->FailedFields);
+    }
+}
+
+void UXRDMService::ReadAttributes(FXRDMAttributes& Out, const uint32 Fields) const
+{
+    for (uint32 i = 0; i < static_cast<uint32>(EXRDMAttribute::Count); ++i)
+    {
+        const EXRDMAttribute Field = static_cast<EXRDMAttribute>(i);
+        if ((Fields & FXRDMAttributes::FieldBit(Field)) && !ReadAttribute(Field, Out))
+        {
+            Out.FailedFields |= FXRDMAttributes::FieldBit(Field);
+        }
+    }
+}
+
+bool UXRDMService::ReadAttribute(const EXRDMAttribute Field, FXRDMAttributes& Out) const
 {
-    if (!IsConnected()) return FString();
-    
 #if PLATFORM_ANDROID
-    return CallJNIResultString("getDeviceId");
+    return FetchAttribute(Field, Out);
+#elif !UE_BUILD_SHIPPING
+    return MockAttributeSource ? MockAttributeSource(Field, Out) : false;
 #else
-    return FString();
+    return false;
 #endif
 }
 
-FString UXRDMService::GetDeviceSerial() const
+void UXRDMService::ClearAttributes()
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getDeviceSerial");
-#else
-    return FString();
+    FWriteScopeLock WriteLock(AttributesLock);
+    Attributes.Reset();
+    NextAttributeRetrySeconds = 0.0;
+}
+
+#if !PLATFORM_ANDROID && !UE_BUILD_SHIPPING
+void UXRDMService::SetMockAttributes(const FXRDMAttributes& InAttributes)
+{
+    {
+        FWriteScopeLock WriteLock(AttributesLock);
+        Attributes = MakeShared<FXRDMAttributes, ESPMode::ThreadSafe>(InAttributes);
+    }
+    bIsInitialized = true;
+    CompleteConnectionAttempt(true);
+}
+
+void UXRDMService::SetMockAttributeSource(TFunction<bool(EXRDMAttribute, FXRDMAttributes&)> Source)
+{
+    MockAttributeSource = MoveTemp(Source);
+    ClearAttributes();
+    bIsInitialized = true;
+    CompleteConnectionAttempt(true);
+}
 #endif
+
+FString UXRDMService::GetDeviceId() const
+{
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->DeviceId : FString();
+}
+
+FString UXRDMService::GetDeviceSerial() const
+{
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->DeviceSerial : FString();
 }
 
 FString UXRDMService::GetDeviceTitle() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getDeviceTitle");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->DeviceTitle : FString();
 }
 
 TArray<FString> UXRDMService::GetDeviceTags() const
 {
-    if (!IsConnected()) return TArray<FString>();
-    
-#if PLATFORM_ANDROID
-    return CallJNIStringArrayMethod("getDeviceTags");
-#else
-    return TArray<FString>();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->DeviceTags : TArray<FString>();
 }
 
 FString UXRDMService::GetOrgId() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getOrgId");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->OrgId : FString();
 }
 
 FString UXRDMService::GetOrgTitle() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getOrgTitle");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->OrgTitle : FString();
 }
 
 FString UXRDMService::GetOrgSlug() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getOrgSlug");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->OrgSlug : FString();
 }
 
 FString UXRDMService::GetMacAddressFixed() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getMacAddressFixed");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->MacAddressFixed : FString();
 }
 
 FString UXRDMService::GetMacAddressRandom() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getMacAddressRandom");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->MacAddressRandom : FString();
 }
 
 bool UXRDMService::GetIsAuthenticated() const
@@ -363,7 +458,7 @@ bool UXRDMService::GetIsAuthenticated() const
     if (!IsConnected()) return false;
     
 #if PLATFORM_ANDROID
-    return CallJNIBoolMethod("getIsAuthenticated");
+    return CallJNIBoolMethod(EXRDMMethod::GetIsAuthenticated);
 #else
     return false;
 #endif
@@ -374,7 +469,7 @@ FString UXRDMService::GetAccessToken() const
     if (!IsConnected()) return FString();
     
 #if PLATFORM_ANDROID
-    return CallJNIResultString("getAccessToken");
+    return CallJNIResultString(EXRDMMethod::GetAccessToken);
 #else
     return FString();
 #endif
@@ -385,7 +480,7 @@ FString UXRDMService::GetRefreshToken() const
     if (!IsConnected()) return FString();
     
 #if PLATFORM_ANDROID
-    return CallJNIResultString("getRefreshToken");
+    return CallJNIResultString(EXRDMMethod::GetRefreshToken);
 #else
     return FString();
 #endif
@@ -396,7 +491,7 @@ FDateTime UXRDMService::GetExpiresDateUtc() const
     if (!IsConnected()) return FDateTime::MinValue();
     
 #if PLATFORM_ANDROID
-    return CallJNIDateTimeMethod("getExpiresDateUtc");
+    return CallJNIDateTimeMethod(EXRDMMethod::GetExpiresDateUtc);
 #else
     return FDateTime();
 #endif
@@ -407,7 +502,7 @@ bool UXRDMService::GetIsInitialized() const
     if (!IsConnected()) return false;
     
 #if PLATFORM_ANDROID
-    return CallJNIBoolMethod("getIsInitialized");
+    return CallJNIBoolMethod(EXRDMMethod::GetIsInitialized);
 #else
     return false;
 #endif
@@ -415,13 +510,8 @@ bool UXRDMService::GetIsInitialized() const
 
 FString UXRDMService::GetFingerprint() const
 {
-    if (!IsConnected()) return FString();
-    
-#if PLATFORM_ANDROID
-    return CallJNIResultString("getFingerprint");
-#else
-    return FString();
-#endif
+    const TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Snapshot = GetAttributes();
+    return Snapshot ? Snapshot->Fingerprint : FString();
 }
 
 #if PLATFORM_ANDROID
@@ -503,6 +593,9 @@ void JNICALL UXRDMService::NativeOnConnected(JNIEnv* Env, jclass Clazz, jobject
             {
                 if (StrongInstance->ServiceWrapper)
                 {
+                    // Bound and read once here, before anyone waiting on the connection starts asking for them
+                    StrongInstance->BindServiceMethods(FAndroidApplication::GetJavaEnv());
+                    StrongInstance->RefreshAttributes();
                     StrongInstance->CompleteConnectionAttempt(true);
                     UE_LOG(LogAbxrLib, Log, TEXT("XRDM SDK connected via native callback on attempt #%d"), StrongInstance->ConnectionAttemptCount);
                 }
@@ -531,6 +624,7 @@ void JNICALL UXRDMService::NativeOnDisconnected(JNIEnv* Env, jclass Clazz, jbool
             LocalInstance->ServiceWrapper = nullptr;
         }
         LocalInstance->bIsConnected = false;
+        LocalInstance->ClearAttributes();
         LocalInstance->bConnectionInProgress = false;
         LocalInstance->bConnectCallIssued = false;
         LocalInstance->bConnectionAttemptComplete = true;
@@ -555,6 +649,12 @@ void UXRDMService::InitializeSDK()
         return;
     }
 
+    if (!BindSdkClasses(Env))
+    {
+        HandleRetryableFailure(TEXT("Failed to bind SDK classes"));
+        return;
+    }
+
     jmethodID Constructor = Env->GetMethodID(SdkClass, "<init>", "()V");
     if (!Constructor)
     {
@@ -722,19 +822,151 @@ void UXRDMService::CleanupJNI()
             Env->DeleteGlobalRef(ConnectionCallback);
             ConnectionCallback = nullptr;
         }
+
+        ReleaseBindings(Env);
     }
     
     bIsConnected = false;
+    ClearAttributes();
+}
+
+bool UXRDMService::BindSdkClasses(JNIEnv* Env)
+{
+    if (Bindings.ResultClass) return true;
+
+    jclass LocalResultClass = FAndroidApplication::FindJavaClass("app.xrdm.sdk.external.Result");
+    if (!LocalResultClass)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find Result class"));
+        return false;
+    }
+
+    Bindings.ResultIsOk = Env->GetMethodID(LocalResultClass, "isOk", "()Z");
+    Bindings.ResultGetValue = Env->GetMethodID(LocalResultClass, "getValue", "()Ljava/lang/Object;");
+    Bindings.ResultGetError = Env->GetMethodID(LocalResultClass, "getError", "()Ljava/lang/String;");
+    if (!Bindings.ResultIsOk || !Bindings.ResultGetValue)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find isOk/getValue on Result class"));
+        if (Env->ExceptionCheck()) Env->ExceptionClear();
+        Env->DeleteLocalRef(LocalResultClass);
+        return false;
+    }
+    if (Env->ExceptionCheck()) Env->ExceptionClear();  // getError is optional
+
+    jclass LocalStringArrayClass = Env->FindClass("[Ljava/lang/String;");
+    if (!LocalStringArrayClass)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find String[] class"));
+        if (Env->ExceptionCheck()) Env->ExceptionClear();
+        Env->DeleteLocalRef(LocalResultClass);
+        return false;
+    }
+
+    Bindings.ResultClass = static_cast<jclass>(Env->NewGlobalRef(LocalResultClass));
+    Bindings.StringArrayClass = static_cast<jclass>(Env->NewGlobalRef(LocalStringArrayClass));
+    Env->DeleteLocalRef(LocalResultClass);
+    Env->DeleteLocalRef(LocalStringArrayClass);
+    return Bindings.ResultClass && Bindings.StringArrayClass;
+}
+
+bool UXRDMService::BindServiceMethods(JNIEnv* Env)
+{
+    if (!Env || !ServiceWrapper) return false;
+
+    if (Bindings.ServiceClass)
+    {
+        Env->DeleteGlobalRef(Bindings.ServiceClass);
+        Bindings.ServiceClass = nullptr;
+    }
+
+    jclass LocalServiceClass = Env->GetObjectClass(ServiceWrapper);
+    if (!LocalServiceClass)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Failed to get service wrapper class"));
+        return false;
+    }
+
+    int32 Missing = 0;
+    for (int32 i = 0; i < static_cast<int32>(EXRDMMethod::Count); ++i)
+    {
+        Bindings.ServiceMethods[i] = Env->GetMethodID(LocalServiceClass, XRDMMethodNames[i], "()Lapp/xrdm/sdk/external/Result;");
+        if (!Bindings.ServiceMethods[i])
+        {
+            // Older SDKs lack some accessors; those calls return empty without asking the SDK
+            if (Env->ExceptionCheck()) Env->ExceptionClear();
+            UE_LOG(LogAbxrLib, Warning, TEXT("XRDM Service wrapper has no %s with Result signature"), UTF8_TO_TCHAR(XRDMMethodNames[i]));
+            ++Missing;
+        }
+    }
+
+    Bindings.ServiceClass = static_cast<jclass>(Env->NewGlobalRef(LocalServiceClass));
+    Env->DeleteLocalRef(LocalServiceClass);
+    UE_LOG(LogAbxrLib, Log, TEXT("XRDM Bound %d of %d service methods"), static_cast<int32>(EXRDMMethod::Count) - Missing, static_cast<int32>(EXRDMMethod::Count));
+    return true;
+}
+
+void UXRDMService::ReleaseBindings(JNIEnv* Env)
+{
+    if (Bindings.ResultClass) Env->DeleteGlobalRef(Bindings.ResultClass);
+    if (Bindings.StringArrayClass) Env->DeleteGlobalRef(Bindings.StringArrayClass);
+    if (Bindings.ServiceClass) Env->DeleteGlobalRef(Bindings.ServiceClass);
+    Bindings = FXRDMJNIBindings();
 }
 
-jobject UXRDMService::CallJNIResultMethod(const char* MethodName) const
+const char* UXRDMService::GetMethodName(const EXRDMMethod Method)
 {
+    return XRDMMethodNames[static_cast<int32>(Method)];
+}
+
+bool UXRDMService::FetchAttribute(const EXRDMAttribute Field, FXRDMAttributes& Out) const
+{
+    // Indexed by EXRDMAttribute
+    static constexpr EXRDMMethod Methods[] = {
+        EXRDMMethod::GetDeviceId, EXRDMMethod::GetDeviceSerial, EXRDMMethod::GetDeviceTitle, EXRDMMethod::GetDeviceTags,
+        EXRDMMethod::GetOrgId, EXRDMMethod::GetOrgTitle, EXRDMMethod::GetOrgSlug,
+        EXRDMMethod::GetMacAddressFixed, EXRDMMethod::GetMacAddressRandom, EXRDMMethod::GetFingerprint
+    };
+    static_assert(UE_ARRAY_COUNT(Methods) == static_cast<int32>(EXRDMAttribute::Count), "One method per attribute");
+
+    bool bOk = false;
+    const EXRDMMethod Method = Methods[static_cast<int32>(Field)];
+    if (FString* Value = Out.FindString(Field))
+    {
+        FString Read = CallJNIResultString(Method, &bOk);
+        if (bOk) *Value = MoveTemp(Read);
+    }
+    else
+    {
+        TArray<FString> Tags = CallJNIStringArrayMethod(Method, &bOk);
+        if (bOk) Out.DeviceTags = MoveTemp(Tags);
+    }
+    return bOk;
+}
+
+jobject UXRDMService::CallJNIResultMethod(const EXRDMMethod Method, bool* bOutOk) const
+{
+    const char* MethodName = GetMethodName(Method);
+    if (bOutOk) *bOutOk = false;
     if (!bIsConnected || !ServiceWrapper)
     {
         UE_LOG(LogAbxrLib, Warning, TEXT("XRDM Cannot call %s - service not connected"), UTF8_TO_TCHAR(MethodName));
         return nullptr;
     }
 
+    if (!Bindings.ResultClass)
+    {
+        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Cannot call %s - Result class is not bound"), UTF8_TO_TCHAR(MethodName));
+        return nullptr;
+    }
+
+    // BindServiceMethods already warned that this SDK lacks the accessor; retrying will not change that
+    const jmethodID ServiceMethod = Bindings.ServiceMethods[static_cast<int32>(Method)];
+    if (!ServiceMethod)
+    {
+        if (bOutOk) *bOutOk = true;
+        return nullptr;
+    }
+
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
     if (!Env)
     {
@@ -748,22 +980,8 @@ jobject UXRDMService::CallJNIResultMethod(const char* MethodName) const
         UE_LOG(LogAbxrLib, Warning, TEXT("XRDM Clearing pending exception before calling %s"), UTF8_TO_TCHAR(MethodName));
         Env->ExceptionClear();
     }
-
-    jclass ServiceWrapperClass = Env->GetObjectClass(ServiceWrapper);
-    if (!ServiceWrapperClass)
-    {
-        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Failed to get service wrapper class for %s"), UTF8_TO_TCHAR(MethodName));
-        return nullptr;
-    }
-    
-    jmethodID Method = Env->GetMethodID(ServiceWrapperClass, MethodName, "()Lapp/xrdm/sdk/external/Result;");
-    if (!Method)
-    {
-        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Failed to find method %s with Result signature"), UTF8_TO_TCHAR(MethodName));
-        return nullptr;
-    }
     
-    jobject ResultObject = Env->CallObjectMethod(ServiceWrapper, Method);
+    jobject ResultObject = Env->CallObjectMethod(ServiceWrapper, ServiceMethod);
     
     if (Env->ExceptionCheck())
     {
@@ -779,61 +997,34 @@ jobject UXRDMService::CallJNIResultMethod(const char* MethodName) const
         return nullptr;
     }
     
-    jclass ResultClass = FAndroidApplication::FindJavaClass("app.xrdm.sdk.external.Result");
-    if (!ResultClass)
-    {
-        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find Result class"));
-        Env->DeleteLocalRef(ResultObject);
-        return nullptr;
-    }
-    
-    jmethodID IsOkMethod = Env->GetMethodID(ResultClass, "isOk", "()Z");
-    if (!IsOkMethod)
-    {
-        UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find isOk method on Result class"));
-        Env->DeleteLocalRef(ResultObject);
-        return nullptr;
-    }
-    
-    jboolean IsOk = Env->CallBooleanMethod(ResultObject, IsOkMethod);
-    
-    if (IsOk == JNI_TRUE)
+    if (Env->CallBooleanMethod(ResultObject, Bindings.ResultIsOk) == JNI_TRUE)
     {
-        jmethodID GetValueMethod = Env->GetMethodID(ResultClass, "getValue", "()Ljava/lang/Object;");
-        if (!GetValueMethod)
-        {
-            UE_LOG(LogAbxrLib, Error, TEXT("XRDM Could not find getValue method on Result class"));
-            Env->DeleteLocalRef(ResultObject);
-            return nullptr;
-        }
-        
-        jobject ValueObject = Env->CallObjectMethod(ResultObject, GetValueMethod);
+        if (bOutOk) *bOutOk = true;
+        jobject ValueObject = Env->CallObjectMethod(ResultObject, Bindings.ResultGetValue);
         Env->DeleteLocalRef(ResultObject); // Clean up the Result object
         return ValueObject; // Return the actual value (caller is responsible for cleanup)
     }
-    else
+
+    // Get the error message
+    if (Bindings.ResultGetError)
     {
-        // Get the error message
-        jmethodID GetErrorMethod = Env->GetMethodID(ResultClass, "getError", "()Ljava/lang/String;");
-        if (GetErrorMethod)
+        jstring ErrorString = static_cast<jstring>(Env->CallObjectMethod(ResultObject, Bindings.ResultGetError));
+        if (ErrorString)
         {
-            jstring ErrorString = static_cast<jstring>(Env->CallObjectMethod(ResultObject, GetErrorMethod));
-            if (ErrorString)
-            {
-                const char* ErrorChars = Env->GetStringUTFChars(ErrorString, nullptr);
-                UE_LOG(LogAbxrLib, Error, TEXT("XRDM SDK Error calling %s: %s"), UTF8_TO_TCHAR(MethodName), UTF8_TO_TCHAR(ErrorChars));
-                Env->ReleaseStringUTFChars(ErrorString, ErrorChars);
-                Env->DeleteLocalRef(ErrorString);
-            }
+            const char* ErrorChars = Env->GetStringUTFChars(ErrorString, nullptr);
+            UE_LOG(LogAbxrLib, Error, TEXT("XRDM SDK Error calling %s: %s"), UTF8_TO_TCHAR(MethodName), UTF8_TO_TCHAR(ErrorChars));
+            Env->ReleaseStringUTFChars(ErrorString, ErrorChars);
+            Env->DeleteLocalRef(ErrorString);
         }
-        Env->DeleteLocalRef(ResultObject);
-        return nullptr;
     }
+    Env->DeleteLocalRef(ResultObject);
+    return nullptr;
 }
 
-FString UXRDMService::CallJNIResultString(const char* MethodName) const
+FString UXRDMService::CallJNIResultString(const EXRDMMethod Method, bool* bOutOk) const
 {
-    jobject ValueObject = CallJNIResultMethod(MethodName);
+    const char* MethodName = GetMethodName(Method);
+    jobject ValueObject = CallJNIResultMethod(Method, bOutOk);
     if (!ValueObject) return FString();
     
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
@@ -852,9 +1043,10 @@ FString UXRDMService::CallJNIResultString(const char* MethodName) const
     return FString();
 }
 
-bool UXRDMService::CallJNIBoolMethod(const char* MethodName) const
+bool UXRDMService::CallJNIBoolMethod(const EXRDMMethod Method) const
 {
-    jobject ValueObject = CallJNIResultMethod(MethodName);
+    const char* MethodName = GetMethodName(Method);
+    jobject ValueObject = CallJNIResultMethod(Method);
     if (!ValueObject) return false;
     
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
@@ -877,9 +1069,10 @@ bool UXRDMService::CallJNIBoolMethod(const char* MethodName) const
     return ReturnValue;
 }
 
-FDateTime UXRDMService::CallJNIDateTimeMethod(const char* MethodName) const
+FDateTime UXRDMService::CallJNIDateTimeMethod(const EXRDMMethod Method) const
 {
-    jobject ValueObject = CallJNIResultMethod(MethodName);
+    const char* MethodName = GetMethodName(Method);
+    jobject ValueObject = CallJNIResultMethod(Method);
     if (!ValueObject) return FDateTime();
     
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
@@ -915,17 +1108,22 @@ FDateTime UXRDMService::CallJNIDateTimeMethod(const char* MethodName) const
     return ReturnValue;
 }
 
-TArray<FString> UXRDMService::CallJNIStringArrayMethod(const char* MethodName) const
+TArray<FString> UXRDMService::CallJNIStringArrayMethod(const EXRDMMethod Method, bool* bOutOk) const
 {
+    const char* MethodName = GetMethodName(Method);
     TArray<FString> Result;
     
-    jobject ValueObject = CallJNIResultMethod(MethodName);
+    jobject ValueObject = CallJNIResultMethod(Method, bOutOk);
     if (!ValueObject) return Result;
     
     JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+    if (!Env->IsInstanceOf(ValueObject, Bindings.StringArrayClass))
+    {
+        UE_LOG(LogAbxrLib, Warning, TEXT("XRDM ValueObject is not a String[] for method %s"), UTF8_TO_TCHAR(MethodName));
+        Env->DeleteLocalRef(ValueObject);
+        return Result;
+    }
     
-    // Check if the value is a string array
-    jclass ObjectArrayClass = Env->FindClass("[Ljava/lang/String;");
     jobjectArray StringArray = static_cast<jobjectArray>(ValueObject);
     jsize ArrayLength = Env->GetArrayLength(StringArray);
         
@@ -944,9 +1142,53 @@ TArray<FString> UXRDMService::CallJNIStringArrayMethod(const char* MethodName) c
             UE_LOG(LogAbxrLib, Warning, TEXT("XRDM Null string element at index %d in %s"), i, UTF8_TO_TCHAR(MethodName));
         }
     }
-    Env->DeleteLocalRef(ObjectArrayClass);
-    
     Env->DeleteLocalRef(ValueObject);
     return Result;
 }
-#endif
\ No newline at end of file
+
+#if !UE_BUILD_SHIPPING
+void UXRDMService::RunJNIBenchmark(const int32 Iterations)
+{
+    const UXRDMService* Service = ActiveInstance.Get();
+    JNIEnv* Env = FAndroidApplication::GetJavaEnv();
+    if (!Service || !Service->IsConnected() || !Env)
+    {
+        UE_LOG(LogAbxrLib, Warning, TEXT("Abxr.Bench.XRDM needs a connected XRDM service"));
+        return;
+    }
+
+    const char* MethodName = GetMethodName(EXRDMMethod::GetIsAuthenticated);
+
+    // Before: the lookups CallJNIResultMethod used to repeat on every call
+    double Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        jclass WrapperClass = Env->GetObjectClass(Service->ServiceWrapper);
+        jmethodID Method = Env->GetMethodID(WrapperClass, MethodName, "()Lapp/xrdm/sdk/external/Result;");
+        jobject ResultObject = Method ? Env->CallObjectMethod(Service->ServiceWrapper, Method) : nullptr;
+        jclass ResultClass = FAndroidApplication::FindJavaClass("app.xrdm.sdk.external.Result");
+        if (ResultObject && ResultClass && Env->CallBooleanMethod(ResultObject, Env->GetMethodID(ResultClass, "isOk", "()Z")) == JNI_TRUE)
+        {
+            jobject ValueObject = Env->CallObjectMethod(ResultObject, Env->GetMethodID(ResultClass, "getValue", "()Ljava/lang/Object;"));
+            if (ValueObject) Env->DeleteLocalRef(ValueObject);
+        }
+        if (ResultObject) Env->DeleteLocalRef(ResultObject);
+        if (ResultClass) Env->DeleteLocalRef(ResultClass);
+        Env->DeleteLocalRef(WrapperClass);
+        if (Env->ExceptionCheck()) Env->ExceptionClear();
+    }
+    const double ByNameSeconds = FPlatformTime::Seconds() - Start;
+
+    Start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        if (jobject ValueObject = Service->CallJNIResultMethod(EXRDMMethod::GetIsAuthenticated)) Env->DeleteLocalRef(ValueObject);
+    }
+    const double BoundSeconds = FPlatformTime::Seconds() - Start;
+
+    UE_LOG(LogAbxrLib, Display, TEXT("Abxr.Bench.XRDM (%s, %d calls): resolved by name %.0f calls/s, bound %.0f calls/s"),
+        UTF8_TO_TCHAR(MethodName), Iterations,
+        ByNameSeconds > 0.0 ? Iterations / ByNameSeconds : 0.0, BoundSeconds > 0.0 ? Iterations / BoundSeconds : 0.0);
+}
+#endif
+#endif
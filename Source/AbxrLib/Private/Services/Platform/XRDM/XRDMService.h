@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 #include "Async/Future.h"
 #include "Containers/Ticker.h"
+#include "Misc/ScopeRWLock.h"
 #if PLATFORM_ANDROID
 #include "Android/AndroidJNI.h"
 #include "Android/AndroidApplication.h"
@@ -12,6 +13,81 @@ DECLARE_MULTICAST_DELEGATE(FOnXRDMConnected);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnXRDMConnectionFailed, const FString&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnXRDMDisconnected, bool);
 
+enum class EXRDMAttribute : uint8
+{
+    DeviceId,
+    DeviceSerial,
+    DeviceTitle,
+    DeviceTags,
+    OrgId,
+    OrgTitle,
+    OrgSlug,
+    MacAddressFixed,
+    MacAddressRandom,
+    Fingerprint,
+    Count
+};
+
+// Device and organization attributes, read from the SDK once per connection
+struct FXRDMAttributes
+{
+    static constexpr uint32 AllFields = (1u << static_cast<uint32>(EXRDMAttribute::Count)) - 1;
+    static constexpr uint32 FieldBit(const EXRDMAttribute Field) { return 1u << static_cast<uint32>(Field); }
+
+    FString DeviceId;
+    FString DeviceSerial;
+    FString DeviceTitle;
+    TArray<FString> DeviceTags;
+    FString OrgId;
+    FString OrgTitle;
+    FString OrgSlug;
+    FString MacAddressFixed;
+    FString MacAddressRandom;
+    FString Fingerprint;
+    // FieldBit of every attribute whose last read failed; those keep their previous value
+    uint32 FailedFields = 0;
+
+    // Null for DeviceTags, the one attribute that is not a string
+    FString* FindString(EXRDMAttribute Field);
+};
+
+#if PLATFORM_ANDROID
+// Service wrapper methods the bridge calls; each returns app.xrdm.sdk.external.Result
+enum class EXRDMMethod : uint8
+{
+    GetDeviceId,
+    GetDeviceSerial,
+    GetDeviceTitle,
+    GetDeviceTags,
+    GetOrgId,
+    GetOrgTitle,
+    GetOrgSlug,
+    GetMacAddressFixed,
+    GetMacAddressRandom,
+    GetIsAuthenticated,
+    GetAccessToken,
+    GetRefreshToken,
+    GetExpiresDateUtc,
+    GetIsInitialized,
+    GetFingerprint,
+    Count
+};
+
+// Classes (as global refs) and method ids, resolved once so each call is a direct invocation.
+// Result and String[] are bound in InitializeSDK; the service wrapper's class is only known once it connects.
+struct FXRDMJNIBindings
+{
+    jclass ResultClass = nullptr;
+    jmethodID ResultIsOk = nullptr;
+    jmethodID ResultGetValue = nullptr;
+    jmethodID ResultGetError = nullptr;
+    jclass StringArrayClass = nullptr;
+
+    jclass ServiceClass = nullptr;
+    jmethodID ServiceMethods[static_cast<int32>(EXRDMMethod::Count)] = {};
+};
+#endif
+
 UCLASS()
 class ABXRLIB_API UXRDMService : public UObject
 {
@@ -42,6 +118,21 @@ public:
     bool GetIsInitialized() const;
     FString GetFingerprint() const;
 
+    // Re-reads the cached device/org attributes; otherwise they are read once when the service connects
+    void RefreshAttributes();
+
+#if !PLATFORM_ANDROID && !UE_BUILD_SHIPPING
+    // Stands in for the SDK on desktop builds: marks the service connected with the given attributes
+    void SetMockAttributes(const FXRDMAttributes& InAttributes);
+    // Like SetMockAttributes, but each attribute is read through Source; returning false simulates a failed SDK call
+    void SetMockAttributeSource(TFunction<bool(EXRDMAttribute, FXRDMAttributes&)> Source);
+#endif
+
+#if PLATFORM_ANDROID && !UE_BUILD_SHIPPING
+    // Times an XRDM call through the binding table against resolving everything by name per call (Abxr.Bench.XRDM)
+    static void RunJNIBenchmark(int32 Iterations);
+#endif
+
 protected:
     virtual void BeginDestroy() override;
 
@@ -67,6 +158,23 @@ private:
     bool OnConnectionTimeout(float DeltaTime);
     bool OnConnectionRetry(float DeltaTime);
 
+    // Getters read this snapshot without touching JNI. It is filled lazily if the connect-time read failed, and
+    // attributes that failed to read are retried at most every AttributeRetrySeconds (or by RefreshAttributes)
+    static constexpr double AttributeRetrySeconds = 30.0;
+    TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> GetAttributes() const;
+    TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> UpdateAttributes(uint32 Fields) const;
+    void ClearAttributes();
+    // Reads the Fields attributes into Out, leaving any that fail untouched and flagged in Out.FailedFields
+    void ReadAttributes(FXRDMAttributes& Out, uint32 Fields) const;
+    bool ReadAttribute(EXRDMAttribute Field, FXRDMAttributes& Out) const;
+    mutable FRWLock AttributesLock;
+    mutable TSharedPtr<const FXRDMAttributes, ESPMode::ThreadSafe> Attributes;
+    mutable double NextAttributeRetrySeconds = 0.0;
+
+#if !PLATFORM_ANDROID && !UE_BUILD_SHIPPING
+    TFunction<bool(EXRDMAttribute, FXRDMAttributes&)> MockAttributeSource;
+#endif
+
 #if PLATFORM_ANDROID
     jclass SdkClass = nullptr;
     jobject SdkInstance = nullptr;
@@ -77,11 +185,20 @@ private:
     void ConnectToService();
     void CleanupJNI();
 
-    FString CallJNIResultString(const char* MethodName) const;
-    bool CallJNIBoolMethod(const char* MethodName) const;
-    FDateTime CallJNIDateTimeMethod(const char* MethodName) const;
-    TArray<FString> CallJNIStringArrayMethod(const char* MethodName) const;
-    jobject CallJNIResultMethod(const char* MethodName) const;
+    FXRDMJNIBindings Bindings;
+    bool BindSdkClasses(JNIEnv* Env);
+    bool BindServiceMethods(JNIEnv* Env);
+    void ReleaseBindings(JNIEnv* Env);
+    static const char* GetMethodName(EXRDMMethod Method);
+
+    bool FetchAttribute(EXRDMAttribute Field, FXRDMAttributes& Out) const;
+    // bOutOk, when given, is set only if the SDK call itself succeeded, so a failure can be told from an empty value.
+    // A method this SDK version does not have counts as succeeded with no value.
+    FString CallJNIResultString(EXRDMMethod Method, bool* bOutOk = nullptr) const;
+    bool CallJNIBoolMethod(EXRDMMethod Method) const;
+    FDateTime CallJNIDateTimeMethod(EXRDMMethod Method) const;
+    TArray<FString> CallJNIStringArrayMethod(EXRDMMethod Method, bool* bOutOk = nullptr) const;
+    jobject CallJNIResultMethod(EXRDMMethod Method, bool* bOutOk = nullptr) const;
 
     static bool RegisterNativeMethods();
     static void JNICALL NativeOnConnected(JNIEnv* Env, jclass Clazz, jobject Service);
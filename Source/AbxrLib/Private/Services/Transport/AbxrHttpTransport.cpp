@@ -0,0 +1,115 @@
+#include "AbxrHttpTransport.h"
+#include "HttpModule.h"
+#include "HAL/PlatformTime.h"
+#include "Types/AbxrLog.h"
+
+FAbxrHttpTransport& FAbxrHttpTransport::Get()
+{
+	static FAbxrHttpTransport Transport;
+	return Transport;
+}
+
+FString FAbxrHttpTransport::GetHostKey(const FString& Url)
+{
+	// scheme://host[:port]; connections are pooled per origin
+	const int32 SchemeEnd = Url.Find(TEXT("://"));
+	const int32 HostStart = SchemeEnd == INDEX_NONE ? 0 : SchemeEnd + 3;
+	int32 PathStart = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, HostStart);
+	if (PathStart == INDEX_NONE) PathStart = Url.Len();
+	return Url.Left(PathStart).ToLower();
+}
+
+TSharedRef<IHttpRequest> FAbxrHttpTransport::CreateRequest(const FString& Verb, const FString& Url)
+{
+	const TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Url);
+	Request->SetVerb(Verb);
+	return Request;
+}
+
+bool FAbxrHttpTransport::IsColdLocked(const FString& HostKey, const double Now) const
+{
+	const FHostState* Host = Hosts.Find(HostKey);
+	return !Host || Now - Host->LastActivitySeconds > IdleCloseSeconds;
+}
+
+void FAbxrHttpTransport::ProcessRequest(const TSharedRef<IHttpRequest>& Request)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		const FString HostKey = GetHostKey(Request->GetURL());
+		const double Now = FPlatformTime::Seconds();
+		InFlight.Add(&Request.Get(), IsColdLocked(HostKey, Now));
+		Hosts.FindOrAdd(HostKey).LastActivitySeconds = Now;
+	}
+	Request->ProcessRequest();
+}
+
+void FAbxrHttpTransport::RecordCompletion(const FHttpRequestPtr& Request)
+{
+	if (!Request.IsValid()) return;
+
+	FScopeLock ScopeLock(&Lock);
+	bool bCold = false;
+	if (!InFlight.RemoveAndCopyValue(Request.Get(), bCold)) return;
+
+	Hosts.FindOrAdd(GetHostKey(Request->GetURL())).LastActivitySeconds = FPlatformTime::Seconds();
+
+	const double RttMs = Request->GetElapsedTime() * 1000.0;
+	Stats.LastRttMs = RttMs;
+	++Stats.Requests;
+	if (bCold)
+	{
+		Stats.ColdRttMs = Stats.ColdRequests == 0 ? RttMs : FMath::Lerp(Stats.ColdRttMs, RttMs, RttSmoothing);
+		++Stats.ColdRequests;
+	}
+	else
+	{
+		const int32 WarmRequests = Stats.Requests - Stats.ColdRequests;
+		Stats.WarmRttMs = WarmRequests == 1 ? RttMs : FMath::Lerp(Stats.WarmRttMs, RttMs, RttSmoothing);
+	}
+	if (Stats.ColdRequests > 0 && Stats.Requests > Stats.ColdRequests)
+	{
+		Stats.HandshakeEstimateMs = FMath::Max(0.0, Stats.ColdRttMs - Stats.WarmRttMs);
+	}
+}
+
+void FAbxrHttpTransport::Prewarm(const FString& Url)
+{
+	const FString HostKey = GetHostKey(Url);
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!IsColdLocked(HostKey, FPlatformTime::Seconds())) return;
+		FHostState& Host = Hosts.FindOrAdd(HostKey);
+		if (Host.bPrewarmInFlight) return;
+		Host.bPrewarmInFlight = true;
+		++Stats.Prewarms;
+	}
+
+	// Any response opens the connection; the status is irrelevant. It bypasses ProcessRequest so the
+	// HEAD stays out of the RTT stats, and the host only turns warm once a connection is actually up.
+	const TSharedRef<IHttpRequest> Request = CreateRequest(TEXT("HEAD"), Url);
+	Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+	Request->OnProcessRequestComplete().BindLambda([this, HostKey](const FHttpRequestPtr&, const FHttpResponsePtr& Response, bool)
+	{
+		FScopeLock ScopeLock(&Lock);
+		FHostState& Host = Hosts.FindOrAdd(HostKey);
+		Host.bPrewarmInFlight = false;
+		if (Response.IsValid()) Host.LastActivitySeconds = FPlatformTime::Seconds();
+	});
+	Request->ProcessRequest();
+	UE_LOG(LogAbxrLib, Verbose, TEXT("Prewarming connection to %s"), *HostKey);
+}
+
+bool FAbxrHttpTransport::IsPrewarming(const FString& Url) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FHostState* Host = Hosts.Find(GetHostKey(Url));
+	return Host && Host->bPrewarmInFlight;
+}
+
+FAbxrTransportStats FAbxrHttpTransport::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
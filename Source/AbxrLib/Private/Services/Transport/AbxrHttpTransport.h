@@ -0,0 +1,47 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Types/AbxrPublicTypes.h"
+
+/**
+ * Creates and sends every AbxrLib request, so they all share the engine's pooled connections,
+ * and times them. The engine HTTP backend keeps connections alive per host and multiplexes over
+ * HTTP/2 where it and the server negotiate it; this layer keeps that pool warm for the collector
+ * and reports RTT and an estimate of what a cold connection costs.
+ */
+class FAbxrHttpTransport
+{
+public:
+	static FAbxrHttpTransport& Get();
+
+	// A request with the verb and URL set
+	TSharedRef<IHttpRequest> CreateRequest(const FString& Verb, const FString& Url);
+	void ProcessRequest(const TSharedRef<IHttpRequest>& Request);
+	// Call from the request's completion delegate, whatever the outcome
+	void RecordCompletion(const FHttpRequestPtr& Request);
+	// Opens a connection to Url's host ahead of a send when the pooled one has most likely closed.
+	// Only counted in Prewarms; it never shows up in the request counts or RTTs.
+	void Prewarm(const FString& Url);
+	bool IsPrewarming(const FString& Url) const;
+	FAbxrTransportStats GetStats() const;
+
+private:
+	struct FHostState
+	{
+		double LastActivitySeconds = 0.0;
+		bool bPrewarmInFlight = false;
+	};
+
+	static FString GetHostKey(const FString& Url);
+	bool IsColdLocked(const FString& HostKey, double Now) const;
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FHostState> Hosts;
+	// In-flight requests and whether each went out on a cold host
+	TMap<const IHttpRequest*, bool> InFlight;
+	FAbxrTransportStats Stats;
+
+	// Below libcurl's 118 s connection max age and typical load balancer idle timeouts
+	static constexpr double IdleCloseSeconds = 60.0;
+	static constexpr double RttSmoothing = 0.2;
+};
@@ -6,8 +6,10 @@
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 #include "UI/AbxrUISubsystem.h"
+#include "Subsystems/TelemetrySubsystem.h"
 #include "Async/Async.h"
 #include "Types/AbxrLog.h"
+#include "Util/AbxrSaveSlotWriter.h"
 #include "Util/AbxrUtil.h"
 
 const FString UAbxrSubsystem::SuperMetaDataKey(TEXT("AbxrSuperMetaData"));
@@ -43,16 +45,23 @@ void UAbxrSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	AuthService = MakeShared<FAbxrAuthService>(CreateAuthCallbacks(), XRDMService);
 	DataService = MakeShared<FAbxrDataService>(*AuthService);
 	SuperMetaData = TMap<FString, FString>();
+	SuperMetaDataWriter = MakeShared<FAbxrSaveSlotWriter, ESPMode::ThreadSafe>(SuperMetaDataKey, 0);
 	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
 		this, 
 		&UAbxrSubsystem::OnPostLoadMapWithWorld);
 	
 	AppWillEnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddLambda([this]
 		{
-			if (DataService) DataService->Send(true);
+			if (DataService)
+			{
+				DataService->Send(true);
+				DataService->FlushStorage();
+			}
+			FlushSuperMetaData(true);
 		});
 	
 	LoadSuperMetaData();
+	RebuildSharedMetaSnapshot();
 	if (GetDefault<UAbxrSettings>()->EnableAutoStartAuth)
 	{
 		if (GetDefault<UAbxrSettings>()->AuthenticationStartDelay > 0)
@@ -80,16 +89,17 @@ void UAbxrSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UAbxrSubsystem::Deinitialize()
 {
-	if (AuthService)
+	// The data worker signs requests through AuthService, so it has to be gone first
+	if (DataService)
 	{
-		AuthService->StopReAuthPolling();
-		AuthService.Reset();
+		DataService->Shutdown();
+		DataService.Reset();
 	}
 	
-	if (DataService)
+	if (AuthService)
 	{
-		DataService->Stop();
-		DataService.Reset();
+		AuthService->StopReAuthTimer();
+		AuthService.Reset();
 	}
 	
 	if (GetWorld())
@@ -97,6 +107,8 @@ void UAbxrSubsystem::Deinitialize()
 		GetWorld()->GetTimerManager().ClearTimer(AuthenticationTimerHandle);
 	}
 	
+	FlushSuperMetaData(true);
+	
 	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
 	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(AppWillEnterBackgroundHandle);
 	
@@ -121,6 +133,15 @@ UAbxrUISubsystem* UAbxrSubsystem::GetUISubsystem() const
 	return nullptr;
 }
 
+UTelemetrySubsystem* UAbxrSubsystem::GetTelemetrySubsystem() const
+{
+	if (const UGameInstance* GI = GetGameInstance())
+	{
+		return GI->GetSubsystem<UTelemetrySubsystem>();
+	}
+	return nullptr;
+}
+
 FAbxrAuthCallbacks UAbxrSubsystem::CreateAuthCallbacks()
 {
 	FAbxrAuthCallbacks Callbacks;
@@ -152,6 +173,15 @@ FAbxrAuthCallbacks UAbxrSubsystem::CreateAuthCallbacks()
 			Self->HandleAuthCompleted(false);
 		});
 	};
+	Callbacks.OnConfigUpdated = [WeakThis = TWeakObjectPtr(this)]
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]
+		{
+			if (!WeakThis.IsValid()) return;
+			UAbxrSubsystem* Self = dynamic_cast<UAbxrSubsystem*>(WeakThis.Get());
+			if (Self->DataService) Self->DataService->RefreshSettings();
+		});
+	};
 	
 	return Callbacks;
 }
@@ -196,10 +226,14 @@ void UAbxrSubsystem::PollUser(const FString& Prompt, const EPollType PollType, c
 
 void UAbxrSubsystem::HandleAuthCompleted(const bool bSuccess) const
 {
+	RebuildSharedMetaSnapshot();  // the module list may have changed
 	OnAuthCompleted.Broadcast(bSuccess);
 	
 	if (!bSuccess) return;
 	
+	// Auth may have applied a server config the data worker has not seen yet
+	if (DataService) DataService->RefreshSettings();
+	
 	if (AuthService->GetAuthResponse().Modules.IsEmpty()) return;
 	
 	if (OnModuleTarget.IsBound())
@@ -265,6 +299,7 @@ bool UAbxrSubsystem::StartModuleAtIndex(const int ModuleIndex)
 	}
 	
 	CurrentModuleIndex = ModuleIndex;
+	RebuildSharedMetaSnapshot();
 	OnModuleTarget.Broadcast(AuthService->GetAuthResponse().Modules[CurrentModuleIndex].Target);
 	return true;
 }
@@ -272,6 +307,7 @@ bool UAbxrSubsystem::StartModuleAtIndex(const int ModuleIndex)
 void UAbxrSubsystem::AdvanceToNextModule()
 {
 	CurrentModuleIndex++;
+	RebuildSharedMetaSnapshot();
 	if (CurrentModuleIndex < AuthService->GetAuthResponse().Modules.Num())
 	{
 		UE_LOG(LogAbxrLib, Log, TEXT("Module '%s' complete. Advancing to next module - '%s'"),
@@ -377,9 +413,13 @@ void UAbxrSubsystem::OnPostLoadMapWithWorld(UWorld* LoadedWorld)
 	if (!LoadedWorld) return;
     
 	const FString NewLevelName = LoadedWorld->GetName();
-	if (NewLevelName != CurrentLevel)
+	const FAbxrAtom NewLevel(NewLevelName);
+	if (NewLevel != CurrentLevel)
 	{
-		CurrentLevel = NewLevelName;
+		{
+			FWriteScopeLock WriteLock(SharedMetaLock);
+			CurrentLevel = NewLevel;
+		}
 		if (GetDefault<UAbxrSettings>()->EnableSceneEvents)
 		{
 			TMap<FString, FString> Meta;
@@ -391,27 +431,26 @@ void UAbxrSubsystem::OnPostLoadMapWithWorld(UWorld* LoadedWorld)
 
 void UAbxrSubsystem::Log(const FString& Text, const ELogLevel Level, TMap<FString, FString>& Meta)
 {
-	Meta.Add(TEXT("Scene Name"), CurrentLevel);
-	MergeSuperMetaData(Meta);
-	FString LevelText;
+	static const FAbxrAtom Debug(TEXT("debug")), Info(TEXT("info")), Warn(TEXT("warn")), Error(TEXT("error")), Critical(TEXT("critical"));
+	
+	FAbxrAtom LevelText;
     switch (Level)
     {
-        case ELogLevel::Debug:     LevelText = "debug";     break;
-        case ELogLevel::Info:      LevelText = "info";      break;
-        case ELogLevel::Warn:      LevelText = "warn";      break;
-        case ELogLevel::Error:     LevelText = "error";     break;
-        case ELogLevel::Critical:  LevelText = "critical";  break;
-        default:                   LevelText = "info";      break;
+        case ELogLevel::Debug:     LevelText = Debug;     break;
+        case ELogLevel::Info:      LevelText = Info;      break;
+        case ELogLevel::Warn:      LevelText = Warn;      break;
+        case ELogLevel::Error:     LevelText = Error;     break;
+        case ELogLevel::Critical:  LevelText = Critical;  break;
+        default:                   LevelText = Info;      break;
     }
 
-	DataService->AddLog(LevelText, Text, Meta);
+	// Scene name and super metadata are merged in when the entry is encoded
+	DataService->AddLog(LevelText, Text, Meta, GetCurrentLevel(), GetSharedMetaSnapshot());
 }
 
 void UAbxrSubsystem::Event(const FString& Name, TMap<FString, FString>& Meta)
 {
-	Meta.Add(TEXT("Scene Name"), CurrentLevel);
-	MergeSuperMetaData(Meta);
-	DataService->AddEvent(Name, Meta);
+	DataService->AddEvent(FAbxrAtom(Name), Meta, GetCurrentLevel(), GetSharedMetaSnapshot());
 }
 
 /**
@@ -437,9 +476,37 @@ void UAbxrSubsystem::Event(const FString& Name, const FVector& Position, TMap<FS
 */
 void UAbxrSubsystem::Telemetry(const FString& Name, TMap<FString, FString>& Meta)
 {
-	Meta.Add(TEXT("Scene Name"), CurrentLevel);
-	MergeSuperMetaData(Meta);
-    DataService->AddTelemetry(Name, Meta);
+    DataService->AddTelemetry(FAbxrAtom(Name), Meta, GetCurrentLevel(), GetSharedMetaSnapshot());
+}
+
+void UAbxrSubsystem::TelemetryTyped(const FAbxrAtom Name, const TConstArrayView<FAbxrTelemetryField> Fields)
+{
+	DataService->AddTypedTelemetry(Name, Fields, GetCurrentLevel(), GetSharedMetaSnapshot());
+}
+
+FAbxrSharedMetaPtr UAbxrSubsystem::GetSharedMetaSnapshot() const
+{
+	FReadScopeLock ReadLock(SharedMetaLock);
+	return SharedMetaSnapshot;
+}
+
+FAbxrAtom UAbxrSubsystem::GetCurrentLevel() const
+{
+	FReadScopeLock ReadLock(SharedMetaLock);
+	return CurrentLevel;
+}
+
+void UAbxrSubsystem::RebuildSharedMetaSnapshot() const
+{
+	// Super metadata and the module list are only changed on the game thread
+	ensure(IsInGameThread());
+	// Built outside the lock; readers only ever wait for the pointer swap
+	TMap<FString, FString> Meta;
+	if (AuthService) MergeSuperMetaData(Meta);
+	FAbxrSharedMetaPtr Snapshot = MakeShared<TArray<FAbxrMetaPair>, ESPMode::ThreadSafe>(FAbxrMetaPair::FromMap(Meta));
+
+	FWriteScopeLock WriteLock(SharedMetaLock);
+	SharedMetaSnapshot = MoveTemp(Snapshot);
 }
 
 void UAbxrSubsystem::EventAssessmentStart(const FString& AssessmentName, TMap<FString, FString>& Meta)
@@ -545,6 +612,7 @@ void UAbxrSubsystem::StartNewSession()
 {
 	SuperMetaData.Reset();  // Super metadata is per-session
 	CurrentModuleIndex = 0;
+	RebuildSharedMetaSnapshot();
 	DataService->Send(true);
 	AuthService->SetSessionId(FGuid::NewGuid().ToString());
 	Authenticate();
@@ -585,6 +653,9 @@ void UAbxrSubsystem::Reset()
 
 void UAbxrSubsystem::LoadSuperMetaData()
 {
+	// Don't read the slot while a newer copy is still being written
+	if (SuperMetaDataWriter) SuperMetaDataWriter->Wait();
+	
 	if (!UGameplayStatics::DoesSaveGameExist(SuperMetaDataKey, 0)) return;
 	
 	if (USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SuperMetaDataKey, 0))
@@ -592,26 +663,67 @@ void UAbxrSubsystem::LoadSuperMetaData()
 		if (const USuperMetaSave* SaveObject = Cast<USuperMetaSave>(Loaded))
 		{
 			SuperMetaData = SaveObject->SuperMetaData;
+			RebuildSharedMetaSnapshot();
 		}
 	}
 }
 
-void UAbxrSubsystem::SaveSuperMetaData() const
+void UAbxrSubsystem::SaveSuperMetaData()
 {
-	USuperMetaSave* SaveObject = Cast<USuperMetaSave>(UGameplayStatics::CreateSaveGameObject(USuperMetaSave::StaticClass()));
-	if (!SaveObject) return;
+	RebuildSharedMetaSnapshot();
+	bSuperMetaDataDirty = true;
+	
+	// Not re-armed while pending, so a burst of Register() calls at level load becomes one write
+	if (const UWorld* World = GetWorld())
+	{
+		if (!World->GetTimerManager().IsTimerActive(SuperMetaDataSaveTimerHandle))
+		{
+			World->GetTimerManager().SetTimer(
+				SuperMetaDataSaveTimerHandle,
+				FTimerDelegate::CreateUObject(this, &UAbxrSubsystem::FlushSuperMetaData, false),
+				SuperMetaDataSaveDelaySeconds,
+				false // don't loop
+			);
+		}
+	}
+	else
+	{
+		FlushSuperMetaData();
+	}
+}
 
-	SaveObject->SuperMetaData = SuperMetaData;
-	UGameplayStatics::SaveGameToSlot(SaveObject, SuperMetaDataKey, 0);
+void UAbxrSubsystem::FlushSuperMetaData(const bool bWait)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(SuperMetaDataSaveTimerHandle);
+	}
+	
+	if (bSuperMetaDataDirty && SuperMetaDataWriter)
+	{
+		bSuperMetaDataDirty = false;
+		
+		// Serialized here on the game thread; only the slot write happens in the background
+		USuperMetaSave* SaveObject = Cast<USuperMetaSave>(UGameplayStatics::CreateSaveGameObject(USuperMetaSave::StaticClass()));
+		TArray<uint8> Bytes;
+		if (SaveObject)
+		{
+			SaveObject->SuperMetaData = SuperMetaData;
+			if (UGameplayStatics::SaveGameToMemory(SaveObject, Bytes)) SuperMetaDataWriter->Write(MoveTemp(Bytes));
+		}
+	}
+	
+	if (bWait && SuperMetaDataWriter) SuperMetaDataWriter->Wait();
 }
 
-TMap<FString, FString> UAbxrSubsystem::MergeSuperMetaData(TMap<FString, FString>& Meta)
+void UAbxrSubsystem::MergeSuperMetaData(TMap<FString, FString>& Meta) const
 {
 	// If LMS modules exist, inject current module metadata unless the event already specifies it.
 	// (Data-specific metadata takes precedence.)
-	if (!AuthService->GetAuthResponse().Modules.IsEmpty())
+	// (CurrentModuleIndex runs one past the end once every module is complete.)
+	if (AuthService->GetAuthResponse().Modules.IsValidIndex(CurrentModuleIndex))
 	{
-		const auto [Id, Name, Target, Order] = AuthService->GetAuthResponse().Modules[CurrentModuleIndex];
+		const auto& [Id, Name, Target, Order] = AuthService->GetAuthResponse().Modules[CurrentModuleIndex];
 		if (!Meta.Contains(TEXT("module"))) Meta.Add(TEXT("module"), Target);
 		if (!Meta.Contains(TEXT("moduleName"))) Meta.Add(TEXT("moduleName"), Name);
 		if (!Meta.Contains(TEXT("moduleId"))) Meta.Add(TEXT("moduleId"), Id);
@@ -628,8 +740,6 @@ TMap<FString, FString> UAbxrSubsystem::MergeSuperMetaData(TMap<FString, FString>
 			Meta.Add(SuperMetaDataKeyValue.Key, SuperMetaDataKeyValue.Value);
 		}
 	}
-	
-	return Meta;
 }
 
 bool UAbxrSubsystem::IsReservedSuperMetaDataKey(const FString& Key)
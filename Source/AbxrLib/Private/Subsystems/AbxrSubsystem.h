@@ -1,4 +1,5 @@
 #pragma once
+#include "Misc/ScopeRWLock.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Types/AbxrTypes.h"
 #include "Services/Data/AbxrDataService.h"
@@ -7,6 +8,7 @@
 #include "AbxrSubsystem.generated.h"
 
 class UAbxrUISubsystem;
+class UTelemetrySubsystem;
 
 UCLASS()
 class ABXRLIB_API UAbxrSubsystem : public UGameInstanceSubsystem
@@ -16,6 +18,7 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 	UAbxrUISubsystem* GetUISubsystem() const;
+	UTelemetrySubsystem* GetTelemetrySubsystem() const;
 	void SubmitResponse(const FString& Response, const FAbxrInputRequest& InputRequest);
 	
 	TFunction<void(const FAbxrInputRequest&)> OnInputRequested;
@@ -71,6 +74,8 @@ public:
 		TMap<FString, FString> Meta;
 		Telemetry(Name, Meta);
 	}
+	// Allocation-free variant for per-frame samples; fields are formatted when the batch is encoded
+	void TelemetryTyped(FAbxrAtom Name, TConstArrayView<FAbxrTelemetryField> Fields);
 
 	void EventAssessmentStart(const FString& AssessmentName, TMap<FString, FString>& Meta);
 	void EventAssessmentStart(const FString& AssessmentName)
@@ -164,6 +169,9 @@ public:
 
 	void LoadSuperMetaData();
 
+	EAbxrSendCircuitState GetSendCircuitState() const { return DataService ? DataService->GetCircuitState() : EAbxrSendCircuitState::Closed; }
+	FAbxrIngestStats GetIngestStats() const { return DataService ? DataService->GetIngestStats() : FAbxrIngestStats(); }
+
 private:
 	void OnPostLoadMapWithWorld(UWorld* LoadedWorld);
 	FAbxrAuthCallbacks CreateAuthCallbacks();
@@ -172,12 +180,15 @@ private:
 
 	static void AddDuration(TMap<FString, int64>& StartTimes, const FString& Name, TMap<FString, FString>& Meta);
 	void Register(const FString& Key, const FString& Value, bool Overwrite);
-	void SaveSuperMetaData() const;
+	// Marks super metadata dirty; changes are written together, at most SuperMetaDataSaveDelaySeconds later
+	void SaveSuperMetaData();
+	// Writes pending super metadata changes now; with bWait, also blocks until they are on disk
+	void FlushSuperMetaData(bool bWait = false);
 	static bool IsReservedSuperMetaDataKey(const FString& Key);
 
 	// Private helper function to merge super metadata and module info into metadata
 	// Ensures data-specific metadata take precedence over super metadata and module info
-	TMap<FString, FString> MergeSuperMetaData(TMap<FString, FString>& Meta);
+	void MergeSuperMetaData(TMap<FString, FString>& Meta) const;
 	
 	/// <summary>
 	/// Set module metadata when no modules are provided in authentication.
@@ -215,10 +226,23 @@ private:
 	TMap<FString, int64> ObjectiveStartTimes;
 	TMap<FString, int64> InteractionStartTimes;
 	TMap<FString, int64> LevelStartTimes;
-	FString CurrentLevel;
+	// Written on the game thread only; other threads read it through GetCurrentLevel()
+	FAbxrAtom CurrentLevel;
+	FAbxrAtom GetCurrentLevel() const;
 	
 	TMap<FString, FString> SuperMetaData;
 	static const FString SuperMetaDataKey;
+	static constexpr float SuperMetaDataSaveDelaySeconds = 1.0f;
+	TSharedPtr<class FAbxrSaveSlotWriter, ESPMode::ThreadSafe> SuperMetaDataWriter;
+	FTimerHandle SuperMetaDataSaveTimerHandle;
+	bool bSuperMetaDataDirty = false;
+	
+	// Module info and super metadata as MergeSuperMetaData would add them, referenced by every queued entry.
+	// Rebuilt on the game thread whenever either changes; Log/Event/Telemetry copy the pointer from any thread.
+	FAbxrSharedMetaPtr GetSharedMetaSnapshot() const;
+	void RebuildSharedMetaSnapshot() const;
+	mutable FRWLock SharedMetaLock;
+	mutable FAbxrSharedMetaPtr SharedMetaSnapshot;
 	
 	static const FString PollEventString;
 	static const FString PollResponseString;
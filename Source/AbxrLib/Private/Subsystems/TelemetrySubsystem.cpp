@@ -3,51 +3,62 @@
 #include "AbxrSubsystem.h"
 #include "Services/Config/AbxrSettings.h"
 #include "Engine/Engine.h"
-#include "Misc/App.h"
-#include "GenericPlatform/GenericPlatformMemory.h"
-#include "TimerManager.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/Base64.h"
+#include "Telemetry/AbxrBuiltinTelemetryProviders.h"
+#include "Telemetry/AbxrPlatformTelemetry.h"
 #include "Types/AbxrLog.h"
-#if PLATFORM_ANDROID
-#include "Android/AndroidPlatformMisc.h"
-#endif
 
 void UTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Collection.InitializeDependency<UAbxrSubsystem>();
     Super::Initialize(Collection);
 
-    if (const UWorld* World = GetWorld())
+    if (GetWorld())
     {
-        if (GetDefault<UAbxrSettings>()->EnableAutomaticTelemetry)
+        const UAbxrSettings* Settings = GetDefault<UAbxrSettings>();
+        Scheduler.SetBudgetMicroseconds(Settings->TelemetryFrameBudgetMicroseconds);
+
+        if (Settings->EnableAutomaticTelemetry)
         {
-            World->GetTimerManager().SetTimer(
-                TelemetryTimerHandle,
-                this,
-                &UTelemetrySubsystem::CaptureTelemetry,
-                GetDefault<UAbxrSettings>()->TelemetryTrackingPeriodSeconds,
-                true // loop
-            );
+            FAbxrProviderSettings ProviderSettings;
+            ProviderSettings.ReportSeconds = Settings->TelemetryTrackingPeriodSeconds;
+            ProviderSettings.HeartbeatSeconds = Settings->TelemetryHeartbeatSeconds;
+            ProviderSettings.MemoryDeltaMB = Settings->MemoryDeltaMB;
+            ProviderSettings.BatteryDeltaPercent = Settings->BatteryDeltaPercent;
+            ProviderSettings.ThreadTimeDeltaMs = Settings->ThreadTimeDeltaMs;
+
+            ThreadTimes = MakeShared<FAbxrThreadTimesProvider>(ProviderSettings);
+            RegisterProvider(ThreadTimes.ToSharedRef());
+            RegisterProvider(MakeShared<FAbxrMemoryProvider>(ProviderSettings));
+            RegisterProvider(MakeShared<FAbxrGarbageCollectionProvider>(ProviderSettings));
+            RegisterProvider(MakeShared<FAbxrStreamingProvider>(ProviderSettings));
+            RegisterProvider(MakeShared<FAbxrDeviceProvider>(ProviderSettings, IAbxrPlatformTelemetry::Get()));
         }
 
-        World->GetTimerManager().SetTimer(
-            FrameRateTimerHandle,
-            this,
-            &UTelemetrySubsystem::CaptureFrameRate,
-            GetDefault<UAbxrSettings>()->FrameRateTrackingPeriodSeconds,
-            true // loop
-        );
+        Scheduler.Register(TEXT("Frame Rate"), Settings->FrameRateTrackingPeriodSeconds, [this]
+        {
+            EmitFrameStats();
+            FrameStats.Reset();
+            Scheduler.ReportOverruns();
+        });
 
-        if (GetDefault<UAbxrSettings>()->HeadsetControllerTracking)
+        if (Settings->HeadsetControllerTracking)
         {
-            World->GetTimerManager().SetTimer(
-                PositionDataTimerHandle,
-                this,
-                &UTelemetrySubsystem::CapturePositionData,
-                GetDefault<UAbxrSettings>()->PositionCapturePeriodSeconds,
-                true // loop
-            );
+            LocationDeadband.Configure(Settings->PositionEpsilonCm, Settings->TelemetryHeartbeatSeconds);
+            RotationDeadband.Configure(Settings->RotationEpsilonDegrees, Settings->TelemetryHeartbeatSeconds);
+            Scheduler.Register(TEXT("Position"), Settings->PositionCapturePeriodSeconds, [this] { CapturePositionData(); });
+
+            if (Settings->PoseTrackCapture)
+            {
+                PoseCapture.Init(Settings->PoseCaptureRateHz, Settings->PoseTrackSeconds);
+                PoseCapture.SetDeadband(Settings->PositionEpsilonCm, Settings->RotationEpsilonDegrees, Settings->TelemetryHeartbeatSeconds);
+                Scheduler.Register(TEXT("Pose"), 1.0 / PoseCapture.GetRateHz(), [this] { CapturePose(); });
+            }
         }
+
+        TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UTelemetrySubsystem::Tick));
     }
     else
     {
@@ -57,38 +68,97 @@ void UTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UTelemetrySubsystem::Deinitialize()
 {
-    if (const UWorld* World = GetWorld())
+    while (Providers.Num() > 0)
     {
-        World->GetTimerManager().ClearTimer(TelemetryTimerHandle);
+        const TSharedRef<IAbxrTelemetryProvider> Provider = Providers.Last().Key;
+        UnregisterProvider(Provider);
+    }
+    ThreadTimes.Reset();
+    if (TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+        // Don't lose the partial track
+        UploadPoseTrack();
     }
     
     Super::Deinitialize();
 }
 
-void UTelemetrySubsystem::CaptureFrameRate()
+int32 UTelemetrySubsystem::RegisterCapture(const FName Name, const double PeriodSeconds, TFunction<void()>&& Capture)
 {
-    const float FPS = FApp::GetDeltaTime() > 0.f ? 1.f / FApp::GetDeltaTime() : 0.f;
-    TMap<FString, FString> Meta;
-    Meta.Add(TEXT("Per Second"), LexToString(FPS));
-    Abxr::Telemetry(TEXT("Frame Rate"), Meta);
+    return Scheduler.Register(Name, PeriodSeconds, MoveTemp(Capture));
 }
 
-void UTelemetrySubsystem::CaptureTelemetry() const
+void UTelemetrySubsystem::UnregisterCapture(const int32 Handle)
 {
-    const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
-    TMap<FString, FString> Meta;
-    Meta.Add(TEXT("Used Physical"), FString::FromInt(MemStats.UsedPhysical / 1024.0 / 1024.0) + TEXT(" MB"));
-    Abxr::Telemetry(TEXT("Memory"), Meta);
-#if PLATFORM_ANDROID
-    Meta.Empty();
-    Meta.Add(TEXT("Percentage"), FString::FromInt(FAndroidMisc::GetBatteryState().Level) + TEXT("%"));
-    Meta.Add(TEXT("Temperature"), FString::FromInt(FAndroidMisc::GetBatteryState().Temperature) + TEXT(" C"));
-    Abxr::Telemetry(TEXT("Battery"), Meta);
-#endif
+    Scheduler.Unregister(Handle);
+}
+
+void UTelemetrySubsystem::RegisterProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider)
+{
+    if (Providers.ContainsByPredicate([&Provider](const TPair<TSharedRef<IAbxrTelemetryProvider>, int32>& Entry) { return Entry.Key == Provider; }))
+    {
+        return;
+    }
+
+    Provider->Start();
+    // The subsystem holds the reference, so the scheduled capture can use the raw pointer
+    IAbxrTelemetryProvider* Raw = &Provider.Get();
+    const int32 Handle = Scheduler.Register(Provider->GetName(), Provider->GetPeriodSeconds(), [Raw] { Raw->Capture(); });
+    Providers.Emplace(Provider, Handle);
+}
+
+void UTelemetrySubsystem::UnregisterProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider)
+{
+    const int32 Index = Providers.IndexOfByPredicate([&Provider](const TPair<TSharedRef<IAbxrTelemetryProvider>, int32>& Entry) { return Entry.Key == Provider; });
+    if (Index == INDEX_NONE) return;
+
+    Scheduler.Unregister(Providers[Index].Value);
+    Provider->Stop();
+    Providers.RemoveAt(Index);
 }
 
-void UTelemetrySubsystem::CapturePositionData() const
+bool UTelemetrySubsystem::Tick(const float DeltaTime)
 {
+    FrameStats.AddFrame(DeltaTime);
+    if (ThreadTimes.IsValid()) ThreadTimes->AddFrame();
+    Scheduler.Tick(FPlatformTime::Seconds());
+    return true;
+}
+
+void UTelemetrySubsystem::EmitFrameStats()
+{
+    // Interned once; each sample only copies atom ids and doubles
+    static const FAbxrAtom FrameRate(TEXT("Frame Rate")), PerSecond(TEXT("Per Second")), Ms(TEXT(" ms"));
+    static const FAbxrAtom MinMs(TEXT("Frame Time Min")), AvgMs(TEXT("Frame Time Avg")), MaxMs(TEXT("Frame Time Max")),
+        P50Ms(TEXT("Frame Time P50")), P95Ms(TEXT("Frame Time P95")), P99Ms(TEXT("Frame Time P99")),
+        Hitches(TEXT("Hitches")), Frames(TEXT("Frames"));
+
+    if (FrameStats.Num() == 0) return;
+    const FAbxrFrameStats::FSummary Summary = FrameStats.Summarize();
+
+    // "Per Second" keeps its name so existing dashboards read the window's average frame rate
+    const FAbxrTelemetryField Fields[] = {
+        { PerSecond, Summary.Fps },
+        { MinMs, Summary.MinMs, EAbxrTelemetryFormat::Decimal, Ms },
+        { AvgMs, Summary.AvgMs, EAbxrTelemetryFormat::Decimal, Ms },
+        { MaxMs, Summary.MaxMs, EAbxrTelemetryFormat::Decimal, Ms },
+        { P50Ms, Summary.P50Ms, EAbxrTelemetryFormat::Decimal, Ms },
+        { P95Ms, Summary.P95Ms, EAbxrTelemetryFormat::Decimal, Ms },
+        { P99Ms, Summary.P99Ms, EAbxrTelemetryFormat::Decimal, Ms },
+        { Hitches, static_cast<double>(Summary.Hitches), EAbxrTelemetryFormat::Integer },
+        { Frames, static_cast<double>(Summary.Frames), EAbxrTelemetryFormat::Integer }
+    };
+    static_assert(UE_ARRAY_COUNT(Fields) <= AbxrInlineTelemetryFields, "Frame Rate must fit inline");
+    Abxr::TelemetryTyped(FrameRate, Fields);
+}
+
+void UTelemetrySubsystem::CapturePositionData()
+{
+    static const FAbxrAtom PlayerLocationName(TEXT("Player Location")), X(TEXT("x")), Y(TEXT("y")), Z(TEXT("z"));
+    static const FAbxrAtom PlayerRotationName(TEXT("Player Rotation")), Yaw(TEXT("Yaw")), Pitch(TEXT("Pitch")), Roll(TEXT("Roll"));
+
     FVector PlayerLocation = FVector::ZeroVector;
     FRotator PlayerRotation = FRotator::ZeroRotator;
     if (const UWorld* World = GetWorld())
@@ -103,15 +173,47 @@ void UTelemetrySubsystem::CapturePositionData() const
         }
     }
 
+    const double Now = FPlatformTime::Seconds();
+    if (LocationDeadband.ShouldSend(FVector::Dist(PlayerLocation, LastSentLocation), Now))
+    {
+        LastSentLocation = PlayerLocation;
+        const FAbxrTelemetryField LocationFields[] = {
+            { X, PlayerLocation.X }, { Y, PlayerLocation.Y }, { Z, PlayerLocation.Z }
+        };
+        Abxr::TelemetryTyped(PlayerLocationName, LocationFields);
+    }
+    if (RotationDeadband.ShouldSend(FMath::RadiansToDegrees(PlayerRotation.Quaternion().AngularDistance(LastSentRotation.Quaternion())), Now))
+    {
+        LastSentRotation = PlayerRotation;
+        const FAbxrTelemetryField RotationFields[] = {
+            { Yaw, PlayerRotation.Yaw }, { Pitch, PlayerRotation.Pitch }, { Roll, PlayerRotation.Roll }
+        };
+        Abxr::TelemetryTyped(PlayerRotationName, RotationFields);
+    }
+}
+
+void UTelemetrySubsystem::CapturePose()
+{
+    PoseCapture.Sample(GetWorld());
+    if (PoseCapture.IsFull() || PoseCapture.GetTrackSeconds(FPlatformTime::Seconds()) >= GetDefault<UAbxrSettings>()->TelemetryHeartbeatSeconds)
+    {
+        UploadPoseTrack();
+    }
+}
+
+void UTelemetrySubsystem::UploadPoseTrack()
+{
+    if (PoseCapture.Num() == 0) return;
+
+    const int32 Samples = PoseCapture.Num();
+    PoseTrackBuffer.Reset();
+    PoseCapture.Flush(PoseTrackBuffer);
+
+    // The data endpoint only takes JSON, so the track travels base64-encoded in the entry's meta
     TMap<FString, FString> Meta;
-    Meta.Add(TEXT("x"), LexToString(PlayerLocation.X));
-    Meta.Add(TEXT("y"), LexToString(PlayerLocation.Y));
-    Meta.Add(TEXT("z"), LexToString(PlayerLocation.Z));
-    Abxr::Telemetry(TEXT("Player Location"), Meta);
-
-    Meta.Empty();
-    Meta.Add(TEXT("Yaw"), LexToString(PlayerRotation.Yaw));
-    Meta.Add(TEXT("Pitch"), LexToString(PlayerRotation.Pitch));
-    Meta.Add(TEXT("Roll"), LexToString(PlayerRotation.Roll));
-    Abxr::Telemetry(TEXT("Player Rotation"), Meta);
+    Meta.Add(TEXT("Format"), TEXT("APT1"));
+    Meta.Add(TEXT("Rate Hz"), FString::FromInt(PoseCapture.GetRateHz()));
+    Meta.Add(TEXT("Samples"), FString::FromInt(Samples));
+    Meta.Add(TEXT("Track"), FBase64::Encode(PoseTrackBuffer));
+    Abxr::Telemetry(TEXT("Pose Track"), Meta);
 }
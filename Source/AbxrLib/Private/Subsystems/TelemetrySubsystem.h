@@ -1,11 +1,19 @@
 #pragma once
 #include "CoreMinimal.h"
-#include "Engine/TimerHandle.h"
+#include "AbxrTelemetryProvider.h"
+#include "Containers/Ticker.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Telemetry/AbxrBuiltinTelemetryProviders.h"
+#include "Telemetry/AbxrDeadband.h"
+#include "Telemetry/AbxrFrameStats.h"
+#include "Telemetry/AbxrPoseCapture.h"
+#include "Telemetry/AbxrTelemetryScheduler.h"
 #include "TelemetrySubsystem.generated.h"
 
 /**
- * Collects and sends telemetry (FPS, memory, player position, etc.) periodically.
+ * Collects and sends telemetry (FPS, thread times, memory, GC, streaming, device state, player position, etc.).
+ * Everything other than frame rate and pose comes from IAbxrTelemetryProvider implementations.
+ * Captures share one per-frame tick and a frame-time budget through FAbxrTelemetryScheduler.
  */
 UCLASS()
 class ABXRLIB_API UTelemetrySubsystem : public UGameInstanceSubsystem
@@ -16,11 +24,39 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// Runs Capture on the game thread about every PeriodSeconds, within the shared per-frame budget
+	int32 RegisterCapture(FName Name, double PeriodSeconds, TFunction<void()>&& Capture);
+	void UnregisterCapture(int32 Handle);
+
+	// Schedules Provider->Capture at its period; registering the same provider twice does nothing
+	void RegisterProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider);
+	void UnregisterProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider);
+
 private:
-	void CaptureTelemetry() const;
-	void CaptureFrameRate();
-	void CapturePositionData() const;
-	FTimerHandle TelemetryTimerHandle;
-	FTimerHandle FrameRateTimerHandle;
-	FTimerHandle PositionDataTimerHandle;
+	bool Tick(float DeltaTime);
+	void EmitFrameStats();
+	void CapturePositionData();
+	void CapturePose();
+	void UploadPoseTrack();
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FAbxrTelemetryScheduler Scheduler;
+
+	// Every frame feeds the accumulator; one summary goes out per FrameRateTrackingPeriodSeconds
+	FAbxrFrameStats FrameStats;
+	// Fed every frame like FrameStats; also registered as a provider, which does the reporting
+	TSharedPtr<FAbxrThreadTimesProvider> ThreadTimes;
+
+	// Built-in and game-registered providers with their scheduler handles
+	TArray<TPair<TSharedRef<IAbxrTelemetryProvider>, int32>> Providers;
+
+	// "Player Location" and "Player Rotation" every PositionCapturePeriodSeconds, each through its own dead-band
+	FAbxrDeadband LocationDeadband;
+	FAbxrDeadband RotationDeadband;
+	FVector LastSentLocation = FVector::ZeroVector;
+	FRotator LastSentRotation = FRotator::ZeroRotator;
+
+	// Opt-in (PoseTrackCapture): sampled at PoseCaptureRateHz through a dead-band; a track goes out once it is full or the heartbeat has passed
+	FAbxrPoseCapture PoseCapture;
+	TArray<uint8> PoseTrackBuffer;
 };
@@ -0,0 +1,215 @@
+#include "AbxrBuiltinTelemetryProviders.h"
+#include "AbxrLibAPI.h"
+#include "ContentStreaming.h"
+#include "RenderCore.h"
+#include "RHI.h"
+#include "Telemetry/AbxrPlatformTelemetry.h"
+#include "Types/AbxrTypes.h"
+#include "UObject/UObjectGlobals.h"
+
+FAbxrThreadTimesProvider::FAbxrThreadTimesProvider(const FAbxrProviderSettings& Settings)
+	: ReportSeconds(Settings.ReportSeconds)
+{
+	Deadband.Configure(Settings.ThreadTimeDeltaMs, Settings.HeartbeatSeconds);
+}
+
+void FAbxrThreadTimesProvider::AddFrame()
+{
+	// Cycle counts the engine publishes once per frame, excluding time spent waiting
+	const double Sample[NumThreads] = {
+		FPlatformTime::ToMilliseconds(GGameThreadTime),
+		FPlatformTime::ToMilliseconds(GRenderThreadTime),
+		FPlatformTime::ToMilliseconds(GRHIThreadTime),
+		FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles())
+	};
+	for (int32 i = 0; i < NumThreads; ++i)
+	{
+		SumMs[i] += Sample[i];
+		MaxMs[i] = FMath::Max(MaxMs[i], Sample[i]);
+	}
+	++Samples;
+}
+
+void FAbxrThreadTimesProvider::Capture()
+{
+	static const FAbxrAtom ThreadTimes(TEXT("Thread Times")), Ms(TEXT(" ms"));
+	static const FAbxrAtom GameAvg(TEXT("Game Thread Avg")), GameMax(TEXT("Game Thread Max")),
+		RenderAvg(TEXT("Render Thread Avg")), RenderMax(TEXT("Render Thread Max")),
+		RHIAvg(TEXT("RHI Thread Avg")), RHIMax(TEXT("RHI Thread Max")),
+		GPUAvg(TEXT("GPU Avg")), GPUMax(TEXT("GPU Max"));
+
+	if (Samples == 0) return;
+
+	double Current[NumThreads * 2];
+	double Change = 0.0;
+	for (int32 i = 0; i < NumThreads; ++i)
+	{
+		Current[i] = SumMs[i] / Samples;
+		Current[NumThreads + i] = MaxMs[i];
+	}
+	for (int32 i = 0; i < NumThreads * 2; ++i) Change = FMath::Max(Change, FMath::Abs(Current[i] - SentMs[i]));
+
+	// A new spike moves the maximum, so it gets through even when the averages hold still
+	if (Deadband.ShouldSend(Change, FPlatformTime::Seconds()))
+	{
+		const FAbxrTelemetryField Fields[] = {
+			{ GameAvg, Current[Game], EAbxrTelemetryFormat::Decimal, Ms },
+			{ GameMax, MaxMs[Game], EAbxrTelemetryFormat::Decimal, Ms },
+			{ RenderAvg, Current[Render], EAbxrTelemetryFormat::Decimal, Ms },
+			{ RenderMax, MaxMs[Render], EAbxrTelemetryFormat::Decimal, Ms },
+			{ RHIAvg, Current[RHI], EAbxrTelemetryFormat::Decimal, Ms },
+			{ RHIMax, MaxMs[RHI], EAbxrTelemetryFormat::Decimal, Ms },
+			{ GPUAvg, Current[GPU], EAbxrTelemetryFormat::Decimal, Ms },
+			{ GPUMax, MaxMs[GPU], EAbxrTelemetryFormat::Decimal, Ms }
+		};
+		static_assert(UE_ARRAY_COUNT(Fields) <= AbxrInlineTelemetryFields, "Thread Times must fit inline");
+		Abxr::TelemetryTyped(ThreadTimes, Fields);
+		FMemory::Memcpy(SentMs, Current, sizeof(SentMs));
+	}
+
+	Samples = 0;
+	FMemory::Memzero(SumMs);
+	FMemory::Memzero(MaxMs);
+}
+
+FAbxrMemoryProvider::FAbxrMemoryProvider(const FAbxrProviderSettings& Settings)
+	: ReportSeconds(Settings.ReportSeconds)
+{
+	UsedDeadband.Configure(Settings.MemoryDeltaMB, Settings.HeartbeatSeconds);
+}
+
+void FAbxrMemoryProvider::Capture()
+{
+	static const FAbxrAtom Memory(TEXT("Memory")), UsedPhysical(TEXT("Used Physical")), PeakUsedPhysical(TEXT("Peak Used Physical")),
+		AvailablePhysical(TEXT("Available Physical")), MB(TEXT(" MB"));
+
+	const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
+	const double UsedPhysicalMB = MemStats.UsedPhysical / 1024.0 / 1024.0;
+	if (!UsedDeadband.Update(UsedPhysicalMB, FPlatformTime::Seconds())) return;
+
+	const FAbxrTelemetryField Fields[] = {
+		{ UsedPhysical, UsedPhysicalMB, EAbxrTelemetryFormat::Integer, MB },
+		{ PeakUsedPhysical, MemStats.PeakUsedPhysical / 1024.0 / 1024.0, EAbxrTelemetryFormat::Integer, MB },
+		{ AvailablePhysical, MemStats.AvailablePhysical / 1024.0 / 1024.0, EAbxrTelemetryFormat::Integer, MB }
+	};
+	Abxr::TelemetryTyped(Memory, Fields);
+}
+
+void FAbxrGarbageCollectionProvider::Start()
+{
+	PreHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddLambda([this]
+	{
+		PauseStart = FPlatformTime::Seconds();
+	});
+	PostHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([this]
+	{
+		if (PauseStart == 0.0) return;
+		const double PauseMs = (FPlatformTime::Seconds() - PauseStart) * 1000.0;
+		PauseStart = 0.0;
+		++Pauses;
+		TotalMs += PauseMs;
+		LongestMs = FMath::Max(LongestMs, PauseMs);
+	});
+}
+
+void FAbxrGarbageCollectionProvider::Stop()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostHandle);
+}
+
+void FAbxrGarbageCollectionProvider::Capture()
+{
+	static const FAbxrAtom GarbageCollection(TEXT("Garbage Collection")), Count(TEXT("Pauses")), Total(TEXT("Total Pause")),
+		Longest(TEXT("Longest Pause")), Ms(TEXT(" ms"));
+
+	if (Pauses == 0) return;
+	const FAbxrTelemetryField Fields[] = {
+		{ Count, static_cast<double>(Pauses), EAbxrTelemetryFormat::Integer },
+		{ Total, TotalMs, EAbxrTelemetryFormat::Decimal, Ms },
+		{ Longest, LongestMs, EAbxrTelemetryFormat::Decimal, Ms }
+	};
+	Abxr::TelemetryTyped(GarbageCollection, Fields);
+
+	Pauses = 0;
+	TotalMs = 0.0;
+	LongestMs = 0.0;
+}
+
+FAbxrStreamingProvider::FAbxrStreamingProvider(const FAbxrProviderSettings& Settings)
+	: ReportSeconds(Settings.ReportSeconds)
+{
+	// Any pending work counts as a change; an idle streamer only sends heartbeats
+	Deadband.Configure(1.0, Settings.HeartbeatSeconds);
+}
+
+void FAbxrStreamingProvider::Capture()
+{
+	static const FAbxrAtom Streaming(TEXT("Streaming")), PendingLoads(TEXT("Max Pending Loads")),
+		WantingResources(TEXT("Max Wanting Resources")), LoadingSamplesKey(TEXT("Loading Samples"));
+
+	const int32 PendingNow = GetNumAsyncPackages();
+	MaxPendingLoads = FMath::Max(MaxPendingLoads, PendingNow);
+	MaxWantingResources = FMath::Max(MaxWantingResources, IStreamingManager::Get().GetNumWantingResources());
+	if (PendingNow > 0) ++LoadingSamples;
+
+	const double Now = FPlatformTime::Seconds();
+	if (WindowStart == 0.0) WindowStart = Now;
+	if (Now - WindowStart < ReportSeconds) return;
+
+	if (Deadband.ShouldSend(MaxPendingLoads + MaxWantingResources, Now))
+	{
+		const FAbxrTelemetryField Fields[] = {
+			{ PendingLoads, static_cast<double>(MaxPendingLoads), EAbxrTelemetryFormat::Integer },
+			{ WantingResources, static_cast<double>(MaxWantingResources), EAbxrTelemetryFormat::Integer },
+			{ LoadingSamplesKey, static_cast<double>(LoadingSamples), EAbxrTelemetryFormat::Integer }
+		};
+		Abxr::TelemetryTyped(Streaming, Fields);
+	}
+
+	WindowStart = Now;
+	MaxPendingLoads = 0;
+	MaxWantingResources = 0;
+	LoadingSamples = 0;
+}
+
+FAbxrDeviceProvider::FAbxrDeviceProvider(const FAbxrProviderSettings& Settings, const IAbxrPlatformTelemetry& InBackend)
+	: Backend(InBackend)
+	, ReportSeconds(Settings.ReportSeconds)
+{
+	BatteryLevelDeadband.Configure(Settings.BatteryDeltaPercent, Settings.HeartbeatSeconds);
+	// Battery temperature is reported in whole degrees
+	BatteryTemperatureDeadband.Configure(1.0, Settings.HeartbeatSeconds);
+	ThermalDeadband.Configure(1.0, Settings.HeartbeatSeconds);
+}
+
+void FAbxrDeviceProvider::Capture()
+{
+	static const FAbxrAtom Battery(TEXT("Battery")), Percentage(TEXT("Percentage")), Temperature(TEXT("Temperature")),
+		Percent(TEXT("%")), Celsius(TEXT(" C"));
+	static const FAbxrAtom Thermal(TEXT("Thermal")), Level(TEXT("Level"));
+
+	const double Now = FPlatformTime::Seconds();
+	const FAbxrDeviceReadings Readings = Backend.Read();
+
+	if (Readings.BatteryPercent.IsSet() && Readings.BatteryTemperatureCelsius.IsSet())
+	{
+		// Both gates are updated every time so each keeps its own baseline
+		const bool bLevelChanged = BatteryLevelDeadband.Update(Readings.BatteryPercent.GetValue(), Now);
+		const bool bTemperatureChanged = BatteryTemperatureDeadband.Update(Readings.BatteryTemperatureCelsius.GetValue(), Now);
+		if (bLevelChanged || bTemperatureChanged)
+		{
+			const FAbxrTelemetryField Fields[] = {
+				{ Percentage, Readings.BatteryPercent.GetValue(), EAbxrTelemetryFormat::Integer, Percent },
+				{ Temperature, Readings.BatteryTemperatureCelsius.GetValue(), EAbxrTelemetryFormat::Integer, Celsius }
+			};
+			Abxr::TelemetryTyped(Battery, Fields);
+		}
+	}
+
+	if (Readings.ThermalLevel.IsSet() && ThermalDeadband.Update(Readings.ThermalLevel.GetValue(), Now))
+	{
+		const FAbxrTelemetryField Fields[] = { { Level, Readings.ThermalLevel.GetValue() } };
+		Abxr::TelemetryTyped(Thermal, Fields);
+	}
+}
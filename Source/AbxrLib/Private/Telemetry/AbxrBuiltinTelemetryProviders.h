@@ -0,0 +1,123 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AbxrTelemetryProvider.h"
+#include "Telemetry/AbxrDeadband.h"
+
+class IAbxrPlatformTelemetry;
+
+// Dead-band and cadence settings the built-in providers share, copied from UAbxrSettings
+struct FAbxrProviderSettings
+{
+	double ReportSeconds = 10.0;
+	double HeartbeatSeconds = 60.0;
+	double MemoryDeltaMB = 16.0;
+	double BatteryDeltaPercent = 1.0;
+	double ThreadTimeDeltaMs = 1.0;
+};
+
+/**
+ * Game, render and RHI thread times and GPU frame time from the engine's per-frame counters.
+ * The telemetry subsystem feeds every frame through AddFrame, so the worst frame is never missed;
+ * the average and worst of each go out every ReportSeconds once any of them has moved by ThreadTimeDeltaMs.
+ */
+class FAbxrThreadTimesProvider : public IAbxrTelemetryProvider
+{
+public:
+	explicit FAbxrThreadTimesProvider(const FAbxrProviderSettings& Settings);
+
+	virtual FName GetName() const override { return TEXT("Thread Times"); }
+	virtual double GetPeriodSeconds() const override { return ReportSeconds; }
+	virtual void Capture() override;
+
+	// Once per frame, from the telemetry subsystem's tick
+	void AddFrame();
+
+private:
+	enum EThread { Game, Render, RHI, GPU, NumThreads };
+
+	double ReportSeconds;
+	int32 Samples = 0;
+	double SumMs[NumThreads] = {};
+	double MaxMs[NumThreads] = {};
+	// Last values sent, averages then maxima
+	double SentMs[NumThreads * 2] = {};
+	FAbxrDeadband Deadband;
+};
+
+// Used, peak and available physical memory; sent when used memory moves past MemoryDeltaMB
+class FAbxrMemoryProvider : public IAbxrTelemetryProvider
+{
+public:
+	explicit FAbxrMemoryProvider(const FAbxrProviderSettings& Settings);
+
+	virtual FName GetName() const override { return TEXT("Memory"); }
+	virtual double GetPeriodSeconds() const override { return ReportSeconds; }
+	virtual void Capture() override;
+
+private:
+	double ReportSeconds;
+	FAbxrDeadband UsedDeadband;
+};
+
+// Number, total and longest garbage collection pauses since the last report; nothing is sent while there are none
+class FAbxrGarbageCollectionProvider : public IAbxrTelemetryProvider
+{
+public:
+	explicit FAbxrGarbageCollectionProvider(const FAbxrProviderSettings& Settings) : ReportSeconds(Settings.ReportSeconds) {}
+
+	virtual FName GetName() const override { return TEXT("Garbage Collection"); }
+	virtual double GetPeriodSeconds() const override { return ReportSeconds; }
+	virtual void Capture() override;
+	virtual void Start() override;
+	virtual void Stop() override;
+
+private:
+	double ReportSeconds;
+	FDelegateHandle PreHandle;
+	FDelegateHandle PostHandle;
+	double PauseStart = 0.0;
+	int32 Pauses = 0;
+	double TotalMs = 0.0;
+	double LongestMs = 0.0;
+};
+
+/**
+ * Asset streaming pressure: the most async package loads and texture/mesh streaming requests seen pending,
+ * and how many samples found loading in progress. Frame hitches are part of the "Frame Rate" entry.
+ */
+class FAbxrStreamingProvider : public IAbxrTelemetryProvider
+{
+public:
+	explicit FAbxrStreamingProvider(const FAbxrProviderSettings& Settings);
+
+	virtual FName GetName() const override { return TEXT("Streaming"); }
+	virtual double GetPeriodSeconds() const override { return SamplePeriodSeconds; }
+	virtual void Capture() override;
+
+private:
+	static constexpr double SamplePeriodSeconds = 1.0;
+	double ReportSeconds;
+	double WindowStart = 0.0;
+	int32 MaxPendingLoads = 0;
+	int32 MaxWantingResources = 0;
+	int32 LoadingSamples = 0;
+	FAbxrDeadband Deadband;
+};
+
+// Battery and thermal state from the platform backend; reports nothing where the backend has no readings
+class FAbxrDeviceProvider : public IAbxrTelemetryProvider
+{
+public:
+	FAbxrDeviceProvider(const FAbxrProviderSettings& Settings, const IAbxrPlatformTelemetry& Backend);
+
+	virtual FName GetName() const override { return TEXT("Device"); }
+	virtual double GetPeriodSeconds() const override { return ReportSeconds; }
+	virtual void Capture() override;
+
+private:
+	const IAbxrPlatformTelemetry& Backend;
+	double ReportSeconds;
+	FAbxrDeadband BatteryLevelDeadband;
+	FAbxrDeadband BatteryTemperatureDeadband;
+	FAbxrDeadband ThermalDeadband;
+};
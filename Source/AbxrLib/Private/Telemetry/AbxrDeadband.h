@@ -0,0 +1,42 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Change gate for one telemetry channel: a value is worth sending when it has moved more than
+ * Epsilon from the last one sent, or when HeartbeatSeconds have passed without sending anything,
+ * so a steady channel still shows it is alive.
+ */
+class FAbxrDeadband
+{
+public:
+	void Configure(const double InEpsilon, const double InHeartbeatSeconds)
+	{
+		Epsilon = InEpsilon;
+		HeartbeatSeconds = InHeartbeatSeconds;
+		bHasSent = false;
+	}
+
+	// True when Value should be sent now; the caller is expected to send it
+	bool Update(const double Value, const double Now)
+	{
+		if (!ShouldSend(FMath::Abs(Value - LastValue), Now)) return false;
+		LastValue = Value;
+		return true;
+	}
+
+	// For channels that measure their own change (e.g. distance between poses); marks a send when it passes
+	bool ShouldSend(const double Change, const double Now)
+	{
+		if (bHasSent && Change < Epsilon && Now - LastSentAt < HeartbeatSeconds) return false;
+		bHasSent = true;
+		LastSentAt = Now;
+		return true;
+	}
+
+private:
+	double Epsilon = 0.0;
+	double HeartbeatSeconds = 0.0;
+	double LastValue = 0.0;
+	double LastSentAt = 0.0;
+	bool bHasSent = false;
+};
@@ -0,0 +1,45 @@
+#include "AbxrFrameStats.h"
+
+void FAbxrFrameStats::Reset()
+{
+	FMemory::Memzero(Buckets);
+	Frames = 0;
+	SumMs = 0.0;
+	MinMs = TNumericLimits<double>::Max();
+	MaxMs = 0.0;
+}
+
+double FAbxrFrameStats::Percentile(const double Fraction) const
+{
+	const int32 Rank = FMath::Max(1, FMath::CeilToInt(Fraction * Frames));
+	int32 Seen = 0;
+	for (int32 i = 0; i < NumBuckets; ++i)
+	{
+		Seen += Buckets[i];
+		if (Seen < Rank) continue;
+		// The overflow bucket has no upper edge; otherwise take the bucket's midpoint, kept inside what was observed
+		if (i == NumBuckets - 1) return MaxMs;
+		return FMath::Clamp((i + 0.5) * BucketMs, MinMs, MaxMs);
+	}
+	return MaxMs;
+}
+
+FAbxrFrameStats::FSummary FAbxrFrameStats::Summarize() const
+{
+	FSummary Summary;
+	if (Frames == 0) return Summary;
+
+	Summary.Frames = Frames;
+	Summary.Fps = SumMs > 0.0 ? Frames * 1000.0 / SumMs : 0.0;
+	Summary.MinMs = MinMs;
+	Summary.AvgMs = SumMs / Frames;
+	Summary.MaxMs = MaxMs;
+	Summary.P50Ms = Percentile(0.50);
+	Summary.P95Ms = Percentile(0.95);
+	Summary.P99Ms = Percentile(0.99);
+
+	// Relative to the median, so it means "a visible stutter" at 72 Hz and at 120 Hz alike
+	const int32 FirstHitchBucket = FMath::Min(FMath::CeilToInt(2.0 * Summary.P50Ms / BucketMs), NumBuckets - 1);
+	for (int32 i = FirstHitchBucket; i < NumBuckets; ++i) Summary.Hitches += Buckets[i];
+	return Summary;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Frame-time accumulator cheap enough to update every tick: exact min, max and sum,
+ * plus a fixed-size histogram that percentiles and the hitch count are read from.
+ */
+class FAbxrFrameStats
+{
+public:
+	struct FSummary
+	{
+		int32 Frames = 0;
+		double Fps = 0.0;
+		double MinMs = 0.0;
+		double AvgMs = 0.0;
+		double MaxMs = 0.0;
+		double P50Ms = 0.0;
+		double P95Ms = 0.0;
+		double P99Ms = 0.0;
+		// Frames that took more than twice the median
+		int32 Hitches = 0;
+	};
+
+	FAbxrFrameStats() { Reset(); }
+
+	void AddFrame(const double Seconds)
+	{
+		const double Ms = Seconds * 1000.0;
+		++Buckets[FMath::Clamp(static_cast<int32>(Ms / BucketMs), 0, NumBuckets - 1)];
+		++Frames;
+		SumMs += Ms;
+		MinMs = FMath::Min(MinMs, Ms);
+		MaxMs = FMath::Max(MaxMs, Ms);
+	}
+
+	int32 Num() const { return Frames; }
+	FSummary Summarize() const;
+	void Reset();
+
+	// 0.25 ms buckets up to 64 ms; the last one also takes every longer frame
+	static constexpr double BucketMs = 0.25;
+	static constexpr int32 NumBuckets = 256;
+
+private:
+	double Percentile(double Fraction) const;
+
+	uint32 Buckets[NumBuckets];
+	int32 Frames = 0;
+	double SumMs = 0.0;
+	double MinMs = 0.0;
+	double MaxMs = 0.0;
+};
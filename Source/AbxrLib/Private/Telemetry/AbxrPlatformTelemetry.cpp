@@ -0,0 +1,36 @@
+#include "AbxrPlatformTelemetry.h"
+#if PLATFORM_ANDROID
+#include "Android/AndroidPlatformMisc.h"
+#endif
+
+#if PLATFORM_ANDROID
+namespace
+{
+	class FAbxrAndroidPlatformTelemetry : public IAbxrPlatformTelemetry
+	{
+	public:
+		virtual FAbxrDeviceReadings Read() const override
+		{
+			FAbxrDeviceReadings Readings;
+			const FAndroidMisc::FBatteryState BatteryState = FAndroidMisc::GetBatteryState();
+			Readings.BatteryPercent = BatteryState.Level;
+			Readings.BatteryTemperatureCelsius = BatteryState.Temperature;
+
+			// -1 when the device does not expose a thermal status
+			const float Level = FPlatformMisc::GetDeviceTemperatureLevel();
+			if (Level >= 0.f) Readings.ThermalLevel = Level;
+			return Readings;
+		}
+	};
+}
+#endif
+
+IAbxrPlatformTelemetry& IAbxrPlatformTelemetry::Get()
+{
+#if PLATFORM_ANDROID
+	static FAbxrAndroidPlatformTelemetry Backend;
+#else
+	static FAbxrNullPlatformTelemetry Backend;
+#endif
+	return Backend;
+}
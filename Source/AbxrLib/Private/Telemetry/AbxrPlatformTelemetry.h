@@ -0,0 +1,31 @@
+#pragma once
+#include "CoreMinimal.h"
+
+// Device readings that only some platforms can provide; unset means "not available here"
+struct FAbxrDeviceReadings
+{
+	TOptional<double> BatteryPercent;
+	TOptional<double> BatteryTemperatureCelsius;
+	// Platform-relative thermal throttling level, higher is hotter
+	TOptional<double> ThermalLevel;
+};
+
+/**
+ * Platform backend for the device telemetry provider.
+ * Android reads the battery and thermal state; every other platform gets the null backend,
+ * which reports nothing, so the providers build and run unchanged on Linux, Windows and in the editor.
+ */
+class IAbxrPlatformTelemetry
+{
+public:
+	virtual ~IAbxrPlatformTelemetry() = default;
+	virtual FAbxrDeviceReadings Read() const = 0;
+
+	static IAbxrPlatformTelemetry& Get();
+};
+
+class FAbxrNullPlatformTelemetry : public IAbxrPlatformTelemetry
+{
+public:
+	virtual FAbxrDeviceReadings Read() const override { return {}; }
+};
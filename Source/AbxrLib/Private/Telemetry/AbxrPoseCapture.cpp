@@ -0,0 +1,204 @@
+#include "AbxrPoseCapture.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Features/IModularFeatures.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "IMotionController.h"
+#include "IXRTrackingSystem.h"
+
+namespace
+{
+	void WriteVarint(TArray<uint8>& Out, const int64 Value)
+	{
+		uint64 ZigZag = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+		while (ZigZag >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(ZigZag | 0x80));
+			ZigZag >>= 7;
+		}
+		Out.Add(static_cast<uint8>(ZigZag));
+	}
+
+	void WriteLittleEndian(TArray<uint8>& Out, const uint64 Value, const int32 Bytes)
+	{
+		for (int32 i = 0; i < Bytes; ++i) Out.Add(static_cast<uint8>(Value >> (8 * i)));
+	}
+}
+
+void FAbxrPoseCapture::Init(const int32 InRateHz, const double TrackSeconds)
+{
+	RateHz = FMath::Clamp(InRateHz, 1, 120);
+	Capacity = FMath::Max(1, FMath::CeilToInt(RateHz * TrackSeconds));
+
+	// Everything is sized once here; sampling never allocates
+	TimeMs.SetNumUninitialized(Capacity);
+	for (int32 Device = 0; Device < NumDevices; ++Device)
+	{
+		for (TArray<float>& Channel : Channels[Device]) Channel.SetNumUninitialized(Capacity);
+		Valid[Device].Init(false, Capacity);
+	}
+	Count = 0;
+}
+
+void FAbxrPoseCapture::SetDeadband(const double InPositionEpsilon, const double RotationEpsilonDegrees, const double HeartbeatSeconds)
+{
+	PositionEpsilon = InPositionEpsilon;
+	RotationEpsilonRadians = FMath::DegreesToRadians(RotationEpsilonDegrees);
+	// Changes are normalized so that 1 means "reached an epsilon"
+	Deadband.Configure(1.0, HeartbeatSeconds);
+}
+
+void FAbxrPoseCapture::Sample(const UWorld* World)
+{
+	if (Count == Capacity) return;
+
+	FPose Poses[NumDevices];
+	FPose& Head = Poses[static_cast<int32>(EAbxrPoseDevice::Head)];
+	Head.bValid = ReadHead(World, Head.Position, Head.Rotation);
+
+	const FTransform TrackingToWorld = GEngine && GEngine->XRSystem.IsValid() ? GEngine->XRSystem->GetTrackingToWorldTransform() : FTransform::Identity;
+	static const FName LeftSource(TEXT("Left")), RightSource(TEXT("Right"));
+	FPose& Left = Poses[static_cast<int32>(EAbxrPoseDevice::LeftController)];
+	Left.bValid = ReadController(World, LeftSource, TrackingToWorld, Left.Position, Left.Rotation);
+	FPose& Right = Poses[static_cast<int32>(EAbxrPoseDevice::RightController)];
+	Right.bValid = ReadController(World, RightSource, TrackingToWorld, Right.Position, Right.Rotation);
+
+	const double Now = FPlatformTime::Seconds();
+	if (!Deadband.ShouldSend(MeasureChange(Poses), Now)) return;
+
+	if (Count == 0)
+	{
+		StartSeconds = Now;
+		StartUnixMs = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+	}
+	const int32 Index = Count++;
+	TimeMs[Index] = static_cast<uint32>((Now - StartSeconds) * 1000.0);
+
+	for (int32 Device = 0; Device < NumDevices; ++Device)
+	{
+		Valid[Device][Index] = Poses[Device].bValid;
+		if (Poses[Device].bValid) Write(Device, Index, Poses[Device].Position, Poses[Device].Rotation);
+		LastPoses[Device] = Poses[Device];
+	}
+}
+
+double FAbxrPoseCapture::MeasureChange(const FPose (&Poses)[NumDevices]) const
+{
+	double Change = 0.0;
+	for (int32 Device = 0; Device < NumDevices; ++Device)
+	{
+		const FPose& Pose = Poses[Device];
+		const FPose& Last = LastPoses[Device];
+		if (Pose.bValid != Last.bValid) return TNumericLimits<double>::Max();
+		if (!Pose.bValid) continue;
+
+		const double Moved = FVector::Dist(Pose.Position, Last.Position);
+		const double Turned = Pose.Rotation.AngularDistance(Last.Rotation);
+		Change = FMath::Max(Change, PositionEpsilon > 0.0 ? Moved / PositionEpsilon : TNumericLimits<double>::Max());
+		Change = FMath::Max(Change, RotationEpsilonRadians > 0.0 ? Turned / RotationEpsilonRadians : TNumericLimits<double>::Max());
+	}
+	return Change;
+}
+
+void FAbxrPoseCapture::Write(const int32 Device, const int32 Index, const FVector& Position, const FQuat& Rotation)
+{
+	// q and -q are the same rotation; keeping w >= 0 stops the deltas jumping across the sign flip
+	const FQuat Q = Rotation.W < 0.0 ? -Rotation : Rotation;
+	TArray<float>* Out = Channels[Device];
+	Out[0][Index] = Position.X;
+	Out[1][Index] = Position.Y;
+	Out[2][Index] = Position.Z;
+	Out[3][Index] = Q.X;
+	Out[4][Index] = Q.Y;
+	Out[5][Index] = Q.Z;
+	Out[6][Index] = Q.W;
+}
+
+bool FAbxrPoseCapture::ReadHead(const UWorld* World, FVector& Position, FQuat& Rotation)
+{
+	if (GEngine && GEngine->XRSystem.IsValid() && GEngine->XRSystem->IsHeadTrackingAllowed())
+	{
+		if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, Rotation, Position))
+		{
+			const FTransform InWorld = FTransform(Rotation, Position) * GEngine->XRSystem->GetTrackingToWorldTransform();
+			Position = InWorld.GetLocation();
+			Rotation = InWorld.GetRotation();
+			return true;
+		}
+	}
+
+	// No HMD (desktop, simulator): the player's view stands in for the head
+	if (World)
+	{
+		if (const APlayerController* PC = World->GetFirstPlayerController())
+		{
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(Position, ViewRotation);
+			Rotation = ViewRotation.Quaternion();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FAbxrPoseCapture::ReadController(const UWorld* World, const FName Source, const FTransform& TrackingToWorld, FVector& Position, FQuat& Rotation)
+{
+	const float WorldToMeters = World && World->GetWorldSettings() ? World->GetWorldSettings()->WorldToMeters : 100.f;
+	const TArray<IMotionController*> Controllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
+	for (const IMotionController* Controller : Controllers)
+	{
+		FRotator Orientation;
+		if (Controller && Controller->GetControllerOrientationAndPosition(0, Source, Orientation, Position, WorldToMeters))
+		{
+			const FTransform InWorld = FTransform(Orientation, Position) * TrackingToWorld;
+			Position = InWorld.GetLocation();
+			Rotation = InWorld.GetRotation();
+			return true;
+		}
+	}
+	return false;
+}
+
+void FAbxrPoseCapture::Flush(TArray<uint8>& Out)
+{
+	Out.Reserve(Out.Num() + 16 + Count * (2 + NumDevices * NumChannels * 2));
+	Out.Append(reinterpret_cast<const uint8*>("APT1"), 4);
+	Out.Add(static_cast<uint8>(NumDevices));
+	WriteLittleEndian(Out, static_cast<uint64>(RateHz), 2);
+	WriteLittleEndian(Out, static_cast<uint64>(StartUnixMs), 8);
+	WriteVarint(Out, Count);
+
+	int64 PrevTime = 0;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		WriteVarint(Out, static_cast<int64>(TimeMs[i]) - PrevTime);
+		PrevTime = TimeMs[i];
+	}
+
+	for (int32 Device = 0; Device < NumDevices; ++Device)
+	{
+		const TBitArray<>& DeviceValid = Valid[Device];
+		uint8* Bitmap = Out.GetData() + Out.AddZeroed((Count + 7) / 8);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (DeviceValid[i]) Bitmap[i >> 3] |= 1 << (i & 7);
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const float* Values = Channels[Device][Channel].GetData();
+			const double Scale = Channel < 3 ? PositionScale : RotationScale;
+			int64 Prev = 0;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				if (!DeviceValid[i]) continue;
+				const int64 Quantized = FMath::RoundToInt64(Values[i] * Scale);
+				WriteVarint(Out, Quantized - Prev);
+				Prev = Quantized;
+			}
+		}
+	}
+
+	Count = 0;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Telemetry/AbxrDeadband.h"
+
+enum class EAbxrPoseDevice : uint8
+{
+	Head,
+	LeftController,
+	RightController,
+	Count
+};
+
+/**
+ * Samples the HMD and both motion controllers into buffers preallocated for one track,
+ * and packs a full track into a compact binary blob.
+ *
+ * Storage is one array per channel (structure of arrays), so a sample is a handful of float
+ * stores and the encoder walks each channel contiguously.
+ *
+ * A sample is only kept when some device moved past the position or rotation epsilon, appeared or
+ * lost tracking, or the heartbeat is due; the per-sample time deltas carry the resulting uneven spacing.
+ *
+ * Track layout (little-endian, integers after the header are zigzag LEB128 varints):
+ *   "APT1" | uint8 DeviceCount | uint16 RateHz | int64 StartUnixMs | varint SampleCount
+ *   | SampleCount time deltas in ms
+ *   | per device: validity bitmap (1 bit per sample), then for each of px py pz qx qy qz qw
+ *     the deltas between consecutive valid samples
+ * Positions are world space in 0.1 mm units; quaternion components are scaled by 32767 with w >= 0.
+ */
+class FAbxrPoseCapture
+{
+public:
+	// Capacity is rounded up to a whole number of samples at RateHz over TrackSeconds
+	void Init(int32 RateHz, double TrackSeconds);
+
+	void SetDeadband(double PositionEpsilon, double RotationEpsilonDegrees, double HeartbeatSeconds);
+
+	// Reads every device and records the sample if it passes the dead-band; untracked devices are marked invalid
+	void Sample(const UWorld* World);
+	bool IsFull() const { return Count == Capacity; }
+	int32 Num() const { return Count; }
+	int32 GetRateHz() const { return RateHz; }
+	// Seconds since the first sample of the current track
+	double GetTrackSeconds(const double Now) const { return Count > 0 ? Now - StartSeconds : 0.0; }
+
+	// Appends the current track to Out and starts a new one
+	void Flush(TArray<uint8>& Out);
+
+private:
+	static constexpr int32 NumDevices = static_cast<int32>(EAbxrPoseDevice::Count);
+	static constexpr int32 NumChannels = 7;
+
+	// Positions in Unreal units (cm); scaled to 0.1 mm when encoded
+	static constexpr double PositionScale = 100.0;
+	static constexpr double RotationScale = 32767.0;
+
+	struct FPose
+	{
+		FVector Position = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		bool bValid = false;
+	};
+
+	double MeasureChange(const FPose (&Poses)[NumDevices]) const;
+	void Write(int32 Device, int32 Index, const FVector& Position, const FQuat& Rotation);
+	static bool ReadHead(const UWorld* World, FVector& Position, FQuat& Rotation);
+	static bool ReadController(const UWorld* World, FName Source, const FTransform& TrackingToWorld, FVector& Position, FQuat& Rotation);
+
+	int32 RateHz = 0;
+	int32 Capacity = 0;
+	int32 Count = 0;
+	double StartSeconds = 0.0;
+	int64 StartUnixMs = 0;
+
+	// Indexed by sample
+	TArray<uint32> TimeMs;
+	// [Device][Channel][Sample]; channels are px py pz qx qy qz qw
+	TArray<float> Channels[NumDevices][NumChannels];
+	TBitArray<> Valid[NumDevices];
+
+	// Last recorded pose per device, what the dead-band compares against
+	FPose LastPoses[NumDevices];
+	double PositionEpsilon = 0.0;
+	double RotationEpsilonRadians = 0.0;
+	FAbxrDeadband Deadband;
+};
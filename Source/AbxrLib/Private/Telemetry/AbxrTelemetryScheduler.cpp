@@ -0,0 +1,86 @@
+#include "AbxrTelemetryScheduler.h"
+#include "Types/AbxrLog.h"
+
+int32 FAbxrTelemetryScheduler::Register(const FName Name, const double PeriodSeconds, FCapture&& Capture)
+{
+	// Golden-ratio phases keep any number of captures with equal periods apart from each other
+	static constexpr double PhaseStep = 0.6180339887;
+	const double Phase = FMath::Frac(Tasks.Num() * PhaseStep);
+
+	FTask& Task = Tasks.AddDefaulted_GetRef();
+	Task.Handle = NextHandle++;
+	Task.Name = Name;
+	Task.PeriodSeconds = FMath::Max(PeriodSeconds, 0.0);
+	Task.NextDue = FPlatformTime::Seconds() + Task.PeriodSeconds * Phase;
+	Task.Capture = MoveTemp(Capture);
+	return Task.Handle;
+}
+
+void FAbxrTelemetryScheduler::Unregister(const int32 Handle)
+{
+	Tasks.RemoveAll([Handle](const FTask& Task) { return Task.Handle == Handle; });
+}
+
+void FAbxrTelemetryScheduler::Tick(const double Now)
+{
+	Due.Reset();
+	for (int32 i = 0; i < Tasks.Num(); ++i)
+	{
+		if (Tasks[i].NextDue <= Now) Due.Add(i);
+	}
+	if (Due.Num() == 0) return;
+	Due.Sort([this](const int32 A, const int32 B) { return Tasks[A].NextDue < Tasks[B].NextDue; });
+	// Held as handles from here on: a capture may register or unregister and shift Tasks
+	for (int32& Entry : Due) Entry = Tasks[Entry].Handle;
+
+	const uint64 Start = FPlatformTime::Cycles64();
+	double ElapsedMicroseconds = 0.0;
+	FName Heaviest;
+	double HeaviestMicroseconds = 0.0;
+	int32 Ran = 0;
+	for (; Ran < Due.Num(); ++Ran)
+	{
+		if (Ran > 0 && ElapsedMicroseconds >= BudgetMicroseconds) break;
+
+		const int32 Handle = Due[Ran];
+		FTask* Task = Tasks.FindByPredicate([Handle](const FTask& Candidate) { return Candidate.Handle == Handle; });
+		if (!Task) continue;
+		const FName Name = Task->Name;
+		Task->NextDue += Task->PeriodSeconds;
+		// After a stall, resume the cadence from now rather than running every missed period back to back
+		if (Task->NextDue <= Now) Task->NextDue = Now + Task->PeriodSeconds;
+		// Copied out so the capture can safely unregister itself
+		const FCapture Capture = Task->Capture;
+		Capture();
+
+		const double Total = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start) * 1000.0;
+		if (Total - ElapsedMicroseconds > HeaviestMicroseconds)
+		{
+			HeaviestMicroseconds = Total - ElapsedMicroseconds;
+			Heaviest = Name;
+		}
+		ElapsedMicroseconds = Total;
+		++Stats.Runs;
+	}
+	Stats.Deferred += Due.Num() - Ran;
+
+	if (ElapsedMicroseconds > BudgetMicroseconds)
+	{
+		++Stats.Overruns;
+		if (ElapsedMicroseconds > Stats.WorstFrameMicroseconds)
+		{
+			Stats.WorstFrameMicroseconds = ElapsedMicroseconds;
+			Stats.WorstCapture = Heaviest;
+		}
+	}
+}
+
+void FAbxrTelemetryScheduler::ReportOverruns()
+{
+	if (Stats.Overruns == 0) return;
+	UE_LOG(LogAbxrLib, Warning, TEXT("Telemetry capture went over its %.0f us budget on %llu frame(s); worst %.0f us, heaviest capture %s"),
+		BudgetMicroseconds, Stats.Overruns, Stats.WorstFrameMicroseconds, *Stats.WorstCapture.ToString());
+	Stats.Overruns = 0;
+	Stats.WorstFrameMicroseconds = 0.0;
+	Stats.WorstCapture = NAME_None;
+}
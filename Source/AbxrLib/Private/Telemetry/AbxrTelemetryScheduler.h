@@ -0,0 +1,55 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Runs periodic telemetry captures from one per-frame tick instead of a timer each.
+ *
+ * Every frame the most overdue captures run until the frame's microsecond budget is spent; the rest wait
+ * for a later frame, so captures that share a period never pile onto the same frame. At least one due
+ * capture runs per frame so a single capture that is larger than the budget cannot starve.
+ * Frames that end over budget are counted and summarized in the log by ReportOverruns.
+ */
+class FAbxrTelemetryScheduler
+{
+public:
+	using FCapture = TFunction<void()>;
+
+	struct FStats
+	{
+		uint64 Runs = 0;
+		// Runs that were due but waited for a later frame
+		uint64 Deferred = 0;
+		// Frames whose captures took longer than the budget
+		uint64 Overruns = 0;
+		double WorstFrameMicroseconds = 0.0;
+		FName WorstCapture;
+	};
+
+	void SetBudgetMicroseconds(const double InBudget) { BudgetMicroseconds = FMath::Max(InBudget, 0.0); }
+
+	// Captures start staggered across their first period; returns a handle for Unregister
+	int32 Register(FName Name, double PeriodSeconds, FCapture&& Capture);
+	void Unregister(int32 Handle);
+
+	void Tick(double Now);
+
+	// Logs and clears the overrun counters when any frame went over budget since the last call
+	void ReportOverruns();
+	const FStats& GetStats() const { return Stats; }
+
+private:
+	struct FTask
+	{
+		int32 Handle = INDEX_NONE;
+		FName Name;
+		double PeriodSeconds = 0.0;
+		double NextDue = 0.0;
+		FCapture Capture;
+	};
+
+	TArray<FTask> Tasks;
+	TArray<int32> Due;
+	int32 NextHandle = 0;
+	double BudgetMicroseconds = 500.0;
+	FStats Stats;
+};
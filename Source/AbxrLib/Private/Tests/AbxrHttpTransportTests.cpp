@@ -0,0 +1,123 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Services/Transport/AbxrHttpTransport.h"
+#include "Tests/AutomationCommon.h"
+
+namespace AbxrHttpTransportTests
+{
+	// Unlikely to collide with anything else listening on a dev machine
+	static constexpr uint32 Port = 18431;
+	static constexpr double TimeoutSeconds = 10.0;
+
+	struct FState
+	{
+		TSharedPtr<IHttpRouter> Router;
+		FHttpRouteHandle Route;
+		FAbxrTransportStats Before;
+		double StartSeconds = 0.0;
+		bool bPrewarmed = false;
+		bool bPostDone = false;
+		int32 PostStatus = 0;
+	};
+
+	static FString GetUrl()
+	{
+		return FString::Printf(TEXT("http://127.0.0.1:%u/v1/collect/data"), Port);
+	}
+
+	static FHttpRequestHandler MakeCollectHandler()
+	{
+		auto Handle = [](const FHttpServerRequest&, const FHttpResultCallback& OnComplete)
+		{
+			OnComplete(FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json")));
+			return true;
+		};
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		return Handle;
+#else
+		return FHttpRequestHandler::CreateLambda(Handle);
+#endif
+	}
+}
+
+/**
+ * Runs the transport against a collector stub on localhost: a prewarm must leave the request counts
+ * and RTTs alone and make the next POST count as warm, and requests carry no hand-set Connection header.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrHttpTransportLocalServerTest, "AbxrLib.Transport.LocalServer",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrHttpTransportLocalServerTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrHttpTransportTests;
+	FAbxrHttpTransport& Transport = FAbxrHttpTransport::Get();
+	const TSharedRef<FState> State = MakeShared<FState>();
+
+	State->Router = FHttpServerModule::Get().GetHttpRouter(Port);
+	if (!TestTrue(TEXT("Local router created"), State->Router.IsValid())) return false;
+	State->Route = State->Router->BindRoute(FHttpPath(TEXT("/v1/collect/data")), EHttpServerRequestVerbs::VERB_POST, MakeCollectHandler());
+	FHttpServerModule::Get().StartAllListeners();
+
+	TestTrue(TEXT("No hand-set Connection header"), Transport.CreateRequest(TEXT("POST"), GetUrl())->GetHeader(TEXT("Connection")).IsEmpty());
+
+	State->Before = Transport.GetStats();
+	State->StartSeconds = FPlatformTime::Seconds();
+	Transport.Prewarm(GetUrl());
+	// A rerun within the idle window finds the host still warm, and the prewarm is rightly skipped
+	State->bPrewarmed = Transport.IsPrewarming(GetUrl());
+	if (!State->bPrewarmed) AddInfo(TEXT("Local host still warm from an earlier run; prewarm skipped"));
+
+	// The HEAD has no route and gets a 404, which still opens the connection
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]
+	{
+		FAbxrHttpTransport& Transport = FAbxrHttpTransport::Get();
+		const bool bTimedOut = FPlatformTime::Seconds() - State->StartSeconds > TimeoutSeconds;
+		if (Transport.IsPrewarming(GetUrl()) && !bTimedOut) return false;
+		TestFalse(TEXT("Prewarm completed"), bTimedOut);
+
+		const FAbxrTransportStats After = Transport.GetStats();
+		TestEqual(TEXT("Prewarm counted"), After.Prewarms - State->Before.Prewarms, State->bPrewarmed ? 1 : 0);
+		TestEqual(TEXT("Prewarm not counted as a request"), After.Requests - State->Before.Requests, 0);
+		TestEqual(TEXT("Prewarm not counted as cold"), After.ColdRequests - State->Before.ColdRequests, 0);
+		TestEqual(TEXT("Prewarm left the cold RTT alone"), After.ColdRttMs, State->Before.ColdRttMs);
+
+		const TSharedRef<IHttpRequest> Request = Transport.CreateRequest(TEXT("POST"), GetUrl());
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		Request->SetContentAsString(TEXT("{\"event\":[],\"telemetry\":[],\"basicLog\":[]}"));
+		Request->OnProcessRequestComplete().BindLambda([State](const FHttpRequestPtr& Req, const FHttpResponsePtr& Response, bool)
+		{
+			FAbxrHttpTransport::Get().RecordCompletion(Req);
+			State->PostStatus = Response.IsValid() ? Response->GetResponseCode() : 0;
+			State->bPostDone = true;
+		});
+		State->StartSeconds = FPlatformTime::Seconds();
+		Transport.ProcessRequest(Request);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]
+	{
+		const bool bTimedOut = FPlatformTime::Seconds() - State->StartSeconds > TimeoutSeconds;
+		if (!State->bPostDone && !bTimedOut) return false;
+		TestFalse(TEXT("POST completed"), bTimedOut);
+		TestEqual(TEXT("POST status"), State->PostStatus, 200);
+
+		const FAbxrTransportStats After = FAbxrHttpTransport::Get().GetStats();
+		TestEqual(TEXT("POST counted"), After.Requests - State->Before.Requests, 1);
+		TestEqual(TEXT("POST went out on the prewarmed host"), After.ColdRequests - State->Before.ColdRequests, 0);
+
+		State->Router->UnbindRoute(State->Route);
+		return true;
+	}));
+	return true;
+}
+
+#endif
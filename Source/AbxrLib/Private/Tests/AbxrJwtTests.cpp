@@ -0,0 +1,235 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Util/AbxrJwt.h"
+
+namespace AbxrJwtTests
+{
+	static FString EncodeBase64Url(const TArray<uint8>& Bytes)
+	{
+		FString Encoded = FBase64::Encode(Bytes);
+		Encoded.ReplaceCharInline('+', '-');
+		Encoded.ReplaceCharInline('/', '_');
+		while (Encoded.EndsWith(TEXT("="))) Encoded.LeftChopInline(1);
+		return Encoded;
+	}
+
+	static FString EncodeBase64Url(const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		return EncodeBase64Url(TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+	}
+
+	static FString MakeToken(const FString& PayloadJson)
+	{
+		return EncodeBase64Url(FString(TEXT("{\"alg\":\"HS256\",\"typ\":\"JWT\"}"))) + TEXT(".")
+			+ EncodeBase64Url(PayloadJson) + TEXT(".c2lnbmF0dXJl");
+	}
+
+	static const TCHAR* ValidPayload = TEXT("{\"sub\":\"device-1\",\"exp\":1700003600,\"iat\":1700000000}");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrJwtValidTest, "AbxrLib.Jwt.Valid",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrJwtValidTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrJwtTests;
+	struct FCase { const TCHAR* Payload; int64 Exp; int64 Iat; };
+	const FCase Cases[] = {
+		{ ValidPayload, 1700003600, 1700000000 },
+		{ TEXT(" { \"exp\" : 5 , \"iat\" : 4 } "), 5, 4 },
+		{ TEXT("{\"exp\":\"1700003600\"}"), 1700003600, 0 },
+		{ TEXT("{\"exp\":1700003600.75,\"iat\":1.7e9}"), 1700003600, 1700000000 },
+		{ TEXT("{\"exp\":1.7000036E+9,\"iat\":\"17e8\"}"), 1700003600, 1700000000 },
+		{ TEXT("{\"exp\":170000360099e-2,\"iat\":0.0000017e15}"), 1700003600, 1700000000 },
+		{ TEXT("{\"x\":\"}{\\\"exp\\\":1\",\"exp\":3}"), 3, 0 },
+		{ TEXT("{\"nested\":{\"exp\":1,\"list\":[1,[2,{\"iat\":9}]]},\"exp\":7}"), 7, 0 },
+		{ TEXT("{\"expx\":1,\"exp\":8,\"ex\":2}"), 8, 0 },
+		{ TEXT("{\"exp\":253402300800}"), 253402300800, 0 }
+	};
+	for (const FCase& Case : Cases)
+	{
+		FAbxrJwtClaims Claims;
+		if (TestTrue(FString::Printf(TEXT("Reads %s"), Case.Payload), FAbxrJwt::ReadClaims(MakeToken(Case.Payload), Claims)))
+		{
+			TestEqual(FString::Printf(TEXT("exp of %s"), Case.Payload), Claims.Exp, Case.Exp);
+			TestEqual(FString::Printf(TEXT("iat of %s"), Case.Payload), Claims.Iat, Case.Iat);
+		}
+	}
+
+	// No signature segment, and padded or standard-alphabet payloads, are all accepted
+	FAbxrJwtClaims Claims;
+	const FString Token = MakeToken(ValidPayload);
+	TestTrue(TEXT("Two segments"), FAbxrJwt::ReadClaims(FStringView(Token).Left(Token.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd)), Claims));
+	const FString Padded = TEXT("e30.") + FBase64::Encode(FString(TEXT("{\"exp\":12}"))) + TEXT(".");
+	TestTrue(TEXT("Padded payload"), FAbxrJwt::ReadClaims(Padded, Claims) && Claims.Exp == 12);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrJwtTruncatedTest, "AbxrLib.Jwt.Truncated",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrJwtTruncatedTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrJwtTests;
+	const FString Token = MakeToken(ValidPayload);
+	const int32 PayloadEnd = Token.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+
+	// Any cut inside the header or payload loses the closing brace; cuts in the signature do not matter
+	for (int32 Len = 0; Len <= Token.Len(); ++Len)
+	{
+		FAbxrJwtClaims Claims;
+		const bool bRead = FAbxrJwt::ReadClaims(FStringView(Token).Left(Len), Claims);
+		TestTrue(FString::Printf(TEXT("Prefix of %d chars %s"), Len, Len >= PayloadEnd ? TEXT("reads") : TEXT("is rejected")), bRead == (Len >= PayloadEnd));
+	}
+
+	// The same for the decoded JSON itself
+	const FString Payload = ValidPayload;
+	for (int32 Len = 0; Len < Payload.Len(); ++Len)
+	{
+		FAbxrJwtClaims Claims;
+		TestFalse(FString::Printf(TEXT("Payload cut at %d"), Len), FAbxrJwt::ReadClaims(MakeToken(Payload.Left(Len)), Claims));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrJwtMalformedTest, "AbxrLib.Jwt.Malformed",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrJwtMalformedTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrJwtTests;
+	const TCHAR* BadTokens[] = {
+		TEXT(""),
+		TEXT("."),
+		TEXT(".."),
+		TEXT("no-dots-at-all"),
+		TEXT("e30.!!!!.sig"),
+		TEXT("e30.e30=x.sig"),
+		TEXT("e30.A.sig"),
+		TEXT("e30.AAAAA.sig"),
+		TEXT("e30.eyJleHAiOjF9 .sig")
+	};
+	for (const TCHAR* Token : BadTokens)
+	{
+		FAbxrJwtClaims Claims;
+		TestFalse(FString::Printf(TEXT("Rejects token '%s'"), Token), FAbxrJwt::ReadClaims(Token, Claims));
+	}
+
+	const TCHAR* BadPayloads[] = {
+		TEXT("{}"),
+		TEXT("[]"),
+		TEXT("\"exp\""),
+		TEXT("{\"exp\":}"),
+		TEXT("{\"exp\":\"soon\"}"),
+		TEXT("{\"exp\":-5}"),
+		TEXT("{\"exp\":0}"),
+		TEXT("{\"exp\":1,}"),
+		TEXT("{\"exp\" 1}"),
+		TEXT("{exp:1}"),
+		TEXT("{\"exp\":1 \"iat\":2}"),
+		TEXT("{\"exp\":\"1}"),
+		TEXT("{\"x\":\"unterminated,\"exp\":1}"),
+		TEXT("{\"x\":[1,2,\"exp\":1}"),
+		TEXT("{\"x\":\"\\\"}"),
+		TEXT("{\"exp\":1\\"),
+		TEXT("{\"exp\":1.}"),
+		TEXT("{\"exp\":.5}"),
+		TEXT("{\"exp\":1e}"),
+		TEXT("{\"exp\":1e+}"),
+		TEXT("{\"exp\":1 .5}"),
+		TEXT("{\"exp\":5e-1}")
+	};
+	for (const TCHAR* Payload : BadPayloads)
+	{
+		FAbxrJwtClaims Claims;
+		TestFalse(FString::Printf(TEXT("Rejects payload %s"), Payload), FAbxrJwt::ReadClaims(MakeToken(Payload), Claims));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrJwtOversizedTest, "AbxrLib.Jwt.Oversized",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrJwtOversizedTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrJwtTests;
+	FAbxrJwtClaims Claims;
+
+	// Past the 512-byte inline buffer, with the claim at the very end
+	const FString LongValue = FString::ChrN(200000, 'a');
+	TestTrue(TEXT("Long string before exp"), FAbxrJwt::ReadClaims(MakeToken(FString::Printf(TEXT("{\"blob\":\"%s\",\"exp\":42}"), *LongValue)), Claims) && Claims.Exp == 42);
+
+	// Nesting is tracked with a counter, not recursion, so depth costs nothing but time
+	const int32 Depth = 100000;
+	const FString Balanced = FString::Printf(TEXT("{\"deep\":%s%s,\"exp\":43}"), *FString::ChrN(Depth, '['), *FString::ChrN(Depth, ']'));
+	TestTrue(TEXT("Deeply nested value"), FAbxrJwt::ReadClaims(MakeToken(Balanced), Claims) && Claims.Exp == 43);
+	TestFalse(TEXT("Unbalanced nesting"), FAbxrJwt::ReadClaims(MakeToken(TEXT("{\"deep\":") + FString::ChrN(Depth, '[')), Claims));
+
+	// More digits than an int64 holds
+	TestFalse(TEXT("19-digit exp"), FAbxrJwt::ReadClaims(MakeToken(TEXT("{\"exp\":1234567890123456789}")), Claims));
+	TestFalse(TEXT("Exponent past int64"), FAbxrJwt::ReadClaims(MakeToken(TEXT("{\"exp\":1.7e18}")), Claims));
+	TestFalse(TEXT("Huge exponent"), FAbxrJwt::ReadClaims(MakeToken(TEXT("{\"exp\":1e99999}")), Claims));
+	TestFalse(TEXT("Huge exp"), FAbxrJwt::ReadClaims(MakeToken(TEXT("{\"exp\":") + FString::ChrN(5000, '9') + TEXT("}")), Claims));
+	return true;
+}
+
+// Fixed-seed fuzzing: mutated tokens and random payloads must never read out of bounds,
+// and anything accepted must carry a positive exp
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrJwtFuzzTest, "AbxrLib.Jwt.Fuzz",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrJwtFuzzTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrJwtTests;
+	static const TCHAR Alphabet[] = TEXT("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_+/=.!");
+	static const uint8 JsonBytes[] = { '{', '}', '[', ']', '"', '\\', ':', ',', ' ', '-', '.', 'e', 'x', 'p', 'i', 'a', 't', '0', '1', '9' };
+	FRandomStream Random(0xAB12);
+	const FString Seed = MakeToken(ValidPayload);
+	int32 Accepted = 0;
+
+	for (int32 Iteration = 0; Iteration < 20000; ++Iteration)
+	{
+		FString Token;
+		if (Iteration % 2 == 0)
+		{
+			// Flip, drop or insert characters in a valid token
+			Token = Seed;
+			const int32 Edits = Random.RandRange(1, 4);
+			for (int32 Edit = 0; Edit < Edits && Token.Len() > 0; ++Edit)
+			{
+				const int32 At = Random.RandRange(0, Token.Len() - 1);
+				const TCHAR C = Alphabet[Random.RandRange(0, UE_ARRAY_COUNT(Alphabet) - 2)];
+				switch (Random.RandRange(0, 2))
+				{
+				case 0: Token[At] = C; break;
+				case 1: Token.RemoveAt(At); break;
+				default: Token.InsertAt(At, C); break;
+				}
+			}
+		}
+		else
+		{
+			// JSON-ish garbage, well-formed base64url
+			TArray<uint8> Bytes;
+			const int32 Len = Random.RandRange(0, 64);
+			for (int32 i = 0; i < Len; ++i) Bytes.Add(JsonBytes[Random.RandRange(0, UE_ARRAY_COUNT(JsonBytes) - 1)]);
+			Token = TEXT("e30.") + EncodeBase64Url(Bytes) + TEXT(".");
+		}
+
+		FAbxrJwtClaims Claims;
+		if (FAbxrJwt::ReadClaims(Token, Claims))
+		{
+			++Accepted;
+			if (!TestTrue(FString::Printf(TEXT("Accepted '%s' with a positive exp"), *Token), Claims.Exp > 0)) break;
+		}
+	}
+	AddInfo(FString::Printf(TEXT("%d of 20000 fuzzed tokens accepted"), Accepted));
+	return true;
+}
+
+#endif
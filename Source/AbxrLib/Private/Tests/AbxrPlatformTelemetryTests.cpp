@@ -0,0 +1,56 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Telemetry/AbxrBuiltinTelemetryProviders.h"
+#include "Telemetry/AbxrPlatformTelemetry.h"
+
+namespace AbxrPlatformTelemetryTests
+{
+	// Counts reads so a test can tell the provider asked, whatever the backend answered
+	class FCountingBackend : public IAbxrPlatformTelemetry
+	{
+	public:
+		explicit FCountingBackend(const IAbxrPlatformTelemetry& InInner) : Inner(InInner) {}
+		virtual FAbxrDeviceReadings Read() const override
+		{
+			++Reads;
+			return Inner.Read();
+		}
+
+		const IAbxrPlatformTelemetry& Inner;
+		mutable int32 Reads = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrNullPlatformTelemetryTest, "AbxrLib.Telemetry.NullBackend",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrNullPlatformTelemetryTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrPlatformTelemetryTests;
+
+	const FAbxrNullPlatformTelemetry Null;
+	const FAbxrDeviceReadings Readings = Null.Read();
+	TestFalse(TEXT("No battery level"), Readings.BatteryPercent.IsSet());
+	TestFalse(TEXT("No battery temperature"), Readings.BatteryTemperatureCelsius.IsSet());
+	TestFalse(TEXT("No thermal level"), Readings.ThermalLevel.IsSet());
+
+#if !PLATFORM_ANDROID
+	// Everything but Android gets the null backend
+	const FAbxrDeviceReadings Platform = IAbxrPlatformTelemetry::Get().Read();
+	TestFalse(TEXT("Platform backend reports no battery"), Platform.BatteryPercent.IsSet() || Platform.BatteryTemperatureCelsius.IsSet());
+	TestFalse(TEXT("Platform backend reports no thermal level"), Platform.ThermalLevel.IsSet());
+#endif
+
+	// The device provider keeps polling and copes with nothing to read, even with every heartbeat due
+	FAbxrProviderSettings Settings;
+	Settings.HeartbeatSeconds = 0.0;
+	const FCountingBackend Backend(Null);
+	FAbxrDeviceProvider Provider(Settings, Backend);
+	for (int32 i = 0; i < 3; ++i) Provider.Capture();
+	TestEqual(TEXT("Backend read on every capture"), Backend.Reads, 3);
+	return true;
+}
+
+#endif
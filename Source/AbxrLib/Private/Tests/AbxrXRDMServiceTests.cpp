@@ -0,0 +1,139 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !PLATFORM_ANDROID
+#include "Misc/AutomationTest.h"
+#include "Services/Platform/XRDM/XRDMService.h"
+
+namespace AbxrXRDMServiceTests
+{
+	static FXRDMAttributes MakeAttributes()
+	{
+		FXRDMAttributes Attributes;
+		Attributes.DeviceId = TEXT("device-1");
+		Attributes.DeviceSerial = TEXT("SN-1");
+		Attributes.DeviceTags = { TEXT("lab"), TEXT("loaner") };
+		Attributes.OrgId = TEXT("org-1");
+		Attributes.OrgSlug = TEXT("acme");
+		Attributes.Fingerprint = TEXT("fp-1");
+		return Attributes;
+	}
+
+	// What a working SDK call for Field would write
+	static void ReadField(const EXRDMAttribute Field, FXRDMAttributes& Out)
+	{
+		FXRDMAttributes Source = MakeAttributes();
+		if (FString* Value = Out.FindString(Field)) *Value = *Source.FindString(Field);
+		else Out.DeviceTags = Source.DeviceTags;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrXRDMMockAttributesTest, "AbxrLib.XRDM.MockAttributes",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrXRDMMockAttributesTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrXRDMServiceTests;
+	UXRDMService* Service = NewObject<UXRDMService>();
+	TestEqual(TEXT("Nothing before connecting"), Service->GetDeviceId(), FString());
+
+	Service->SetMockAttributes(MakeAttributes());
+	TestTrue(TEXT("Connected"), Service->IsConnected());
+	TestEqual(TEXT("DeviceId"), Service->GetDeviceId(), FString(TEXT("device-1")));
+	TestEqual(TEXT("DeviceSerial"), Service->GetDeviceSerial(), FString(TEXT("SN-1")));
+	TestEqual(TEXT("DeviceTags"), Service->GetDeviceTags().Num(), 2);
+	TestEqual(TEXT("OrgId"), Service->GetOrgId(), FString(TEXT("org-1")));
+	TestEqual(TEXT("OrgSlug"), Service->GetOrgSlug(), FString(TEXT("acme")));
+	TestEqual(TEXT("Fingerprint"), Service->GetFingerprint(), FString(TEXT("fp-1")));
+
+	Service->Shutdown();
+	TestFalse(TEXT("Disconnected"), Service->IsConnected());
+	TestEqual(TEXT("Cache dropped on shutdown"), Service->GetDeviceId(), FString());
+	return true;
+}
+
+// A failed SDK call must not stick for the rest of the connection, nor make every getter call the SDK again
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrXRDMFailedReadTest, "AbxrLib.XRDM.FailedReadRetries",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrXRDMFailedReadTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrXRDMServiceTests;
+	constexpr int32 NumFields = static_cast<int32>(EXRDMAttribute::Count);
+	UXRDMService* Service = NewObject<UXRDMService>();
+	int32 Reads = 0;
+	bool bFail = true;
+	Service->SetMockAttributeSource([&Reads, &bFail](const EXRDMAttribute Field, FXRDMAttributes& Out)
+	{
+		++Reads;
+		// The serial number always reads; everything else fails while bFail is set
+		if (bFail && Field != EXRDMAttribute::DeviceSerial) return false;
+		ReadField(Field, Out);
+		return true;
+	});
+
+	TestEqual(TEXT("Failed field is empty"), Service->GetDeviceId(), FString());
+	TestEqual(TEXT("Field that read is kept"), Service->GetDeviceSerial(), FString(TEXT("SN-1")));
+	TestEqual(TEXT("Each field read once"), Reads, NumFields);
+
+	// The failed fields wait for the retry interval rather than being read by every getter
+	bFail = false;
+	TestEqual(TEXT("Retry is throttled"), Service->GetDeviceId(), FString());
+	TestEqual(TEXT("No reads from getters"), Reads, NumFields);
+
+	Service->RefreshAttributes();
+	TestEqual(TEXT("Refresh reads every field"), Reads, NumFields * 2);
+	TestEqual(TEXT("Recovered after refresh"), Service->GetDeviceId(), FString(TEXT("device-1")));
+	TestEqual(TEXT("Later getters use the cache"), Service->GetOrgId(), FString(TEXT("org-1")));
+	TestEqual(TEXT("No reads after recovery"), Reads, NumFields * 2);
+
+	// A failed refresh keeps the last good values instead of blanking them
+	bFail = true;
+	AddExpectedError(TEXT("XRDM attribute read failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	Service->RefreshAttributes();
+	TestEqual(TEXT("Refresh attempted"), Reads, NumFields * 3);
+	TestEqual(TEXT("Kept after failed refresh"), Service->GetDeviceId(), FString(TEXT("device-1")));
+	TestEqual(TEXT("Org kept after failed refresh"), Service->GetOrgSlug(), FString(TEXT("acme")));
+	TestEqual(TEXT("Still cached"), Reads, NumFields * 3);
+
+	Service->Shutdown();
+	return true;
+}
+
+// An SDK that never answers one accessor (older versions, or a device with no org) must still cache everything else
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbxrXRDMOneFieldFailsTest, "AbxrLib.XRDM.OneFieldAlwaysFails",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAbxrXRDMOneFieldFailsTest::RunTest(const FString& Parameters)
+{
+	using namespace AbxrXRDMServiceTests;
+	constexpr int32 NumFields = static_cast<int32>(EXRDMAttribute::Count);
+	UXRDMService* Service = NewObject<UXRDMService>();
+	int32 Reads = 0;
+	Service->SetMockAttributeSource([&Reads](const EXRDMAttribute Field, FXRDMAttributes& Out)
+	{
+		++Reads;
+		if (Field == EXRDMAttribute::OrgId) return false;
+		ReadField(Field, Out);
+		return true;
+	});
+
+	for (int32 Round = 0; Round < 5; ++Round)
+	{
+		TestEqual(TEXT("DeviceId"), Service->GetDeviceId(), FString(TEXT("device-1")));
+		TestEqual(TEXT("OrgId"), Service->GetOrgId(), FString());
+		TestEqual(TEXT("OrgSlug"), Service->GetOrgSlug(), FString(TEXT("acme")));
+		TestEqual(TEXT("DeviceTags"), Service->GetDeviceTags().Num(), 2);
+	}
+	TestEqual(TEXT("Read once despite the failing field"), Reads, NumFields);
+
+	AddExpectedError(TEXT("XRDM attribute read failed"), EAutomationExpectedErrorFlags::Contains, 1);
+	Service->RefreshAttributes();
+	TestEqual(TEXT("Refresh reads every field"), Reads, NumFields * 2);
+	TestEqual(TEXT("Still cached after refresh"), Service->GetDeviceSerial(), FString(TEXT("SN-1")));
+	TestEqual(TEXT("No further reads"), Reads, NumFields * 2);
+
+	Service->Shutdown();
+	return true;
+}
+
+#endif
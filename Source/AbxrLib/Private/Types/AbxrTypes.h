@@ -117,6 +117,18 @@ struct FAbxrConfigPayload
 	UPROPERTY() FString MaximumCachedItems;
 	UPROPERTY() FString RetainLocalAfterSent;
 	UPROPERTY() FString PositionCapturePeriod;
+	UPROPERTY() FString DataCompression;
+	UPROPERTY() FString DataCommonMeta;
+};
+
+// What FAbxrAuthService keeps on disk to skip /v1/auth/token on the next launch
+USTRUCT()
+struct FAbxrPersistedAuth
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FAbxrAuthResponse Response;
+	UPROPERTY() int64 TokenExpiry = 0;
 };
 
 struct FAbxrAuthCallbacks
@@ -124,6 +136,8 @@ struct FAbxrAuthCallbacks
 	TFunction<void(const FAbxrInputRequest&)> OnInputRequested;
 	TFunction<void()> OnSucceeded;
 	TFunction<void(const FString&)> OnFailed;
+	// A fresh server config was applied after OnSucceeded already fired
+	TFunction<void()> OnConfigUpdated;
 };
 
 USTRUCT()
@@ -167,6 +181,107 @@ struct FAbxrDataPayloadWrapper
 	UPROPERTY() TArray<FAbxrLogPayload> basicLog;
 };
 
+enum class EAbxrDataKind : uint8
+{
+	Event,
+	Telemetry,
+	Log
+};
+
+inline FArchive& operator<<(FArchive& Ar, FAbxrAtom& Atom)
+{
+	// Ids are only meaningful within one process, so atoms are stored as their text
+	FString Text = Ar.IsLoading() ? FString() : Atom.ToString();
+	Ar << Text;
+	if (Ar.IsLoading()) Atom = FAbxrAtom(Text);
+	return Ar;
+}
+
+inline FArchive& operator<<(FArchive& Ar, FAbxrTelemetryField& Field)
+{
+	uint8 Format = static_cast<uint8>(Field.Format);
+	Ar << Field.Key << Field.Unit << Field.Value << Format;
+	if (Ar.IsLoading()) Field.Format = static_cast<EAbxrTelemetryFormat>(Format);
+	return Ar;
+}
+
+// One meta entry of a queued record. Keys are a small recurring set, so they are interned; values stay free-form text.
+struct FAbxrMetaPair
+{
+	FAbxrAtom Key;
+	FString Value;
+
+	static TArray<FAbxrMetaPair> FromMap(const TMap<FString, FString>& Meta)
+	{
+		TArray<FAbxrMetaPair> Pairs;
+		Pairs.Reserve(Meta.Num());
+		for (const TPair<FString, FString>& Pair : Meta) Pairs.Add({ FAbxrAtom(Pair.Key), Pair.Value });
+		return Pairs;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FAbxrMetaPair& Pair)
+	{
+		return Ar << Pair.Key << Pair.Value;
+	}
+};
+
+// Module info and super metadata, built once per change and referenced by every entry recorded while it is current
+using FAbxrSharedMetaPtr = TSharedPtr<const TArray<FAbxrMetaPair>, ESPMode::ThreadSafe>;
+
+// Fits every built-in record ("Frame Rate" is the largest at 9), so typed telemetry never touches the heap
+static constexpr int32 AbxrInlineTelemetryFields = 10;
+
+// A single queued event, telemetry or log entry as it is held in memory and in the on-disk journal.
+// Seq is assigned by the journal and identifies the entry when it is acknowledged.
+// Names, scene, log level and meta keys are interned, so an entry only owns its free-form text and meta values.
+// The encoder writes meta as Fields, Meta, "Scene Name" and SharedMeta, earlier keys shadowing later ones.
+struct FAbxrDataEntry
+{
+	uint64 Seq = 0;
+	EAbxrDataKind Kind = EAbxrDataKind::Event;
+	int64 TimestampMs = 0;
+	FAbxrAtom Name;      // events and telemetry
+	FAbxrAtom LogLevel;  // logs
+	FAbxrAtom Scene;
+	FString Text;        // logs
+	TArray<FAbxrMetaPair> Meta;
+	TArray<FAbxrTelemetryField, TInlineAllocator<AbxrInlineTelemetryFields>> Fields;  // typed telemetry (Abxr::TelemetryTyped)
+	FAbxrSharedMetaPtr SharedMeta;
+
+	// Heap memory owned by this entry alone; SharedMeta is not counted since every entry of the session references it
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Text.GetAllocatedSize() + Meta.GetAllocatedSize() + Fields.GetAllocatedSize();
+		for (const FAbxrMetaPair& Pair : Meta) Size += Pair.Value.GetAllocatedSize();
+		return Size;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FAbxrDataEntry& Entry)
+	{
+		uint8 Kind = static_cast<uint8>(Entry.Kind);
+		Ar << Entry.Seq << Kind << Entry.TimestampMs << Entry.Name << Entry.LogLevel << Entry.Scene << Entry.Text;
+		Ar << Entry.Meta << Entry.Fields;
+		// SharedMeta is not part of the entry record; the journal writes each snapshot once per segment and links it by id
+		if (Ar.IsLoading()) Entry.Kind = static_cast<EAbxrDataKind>(Kind);
+		return Ar;
+	}
+};
+
+UENUM()
+enum class EAbxrQueueOverflowPolicy : uint8
+{
+	DropOldest,
+	DropNewest,
+	Block
+};
+
+UENUM()
+enum class EAbxrDataCompression : uint8
+{
+	None,
+	Gzip
+};
+
 UENUM()
 enum class EPartner : uint8
 {
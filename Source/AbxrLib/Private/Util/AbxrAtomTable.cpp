@@ -0,0 +1,79 @@
+#include "AbxrAtomTable.h"
+#include "Types/AbxrLog.h"
+#include "Types/AbxrPublicTypes.h"
+
+FAbxrAtomTable& FAbxrAtomTable::Get()
+{
+	static FAbxrAtomTable Table;
+	return Table;
+}
+
+FAbxrAtomTable::FAbxrAtomTable()
+{
+	Strings.Add(MakeUnique<FString>());
+	Ids.Add(FString(), 0);
+}
+
+bool FAbxrAtomTable::Intern(const FStringView Text, uint32& OutId)
+{
+	OutId = 0;
+	if (Text.IsEmpty()) return true;
+
+	const uint32 Hash = FKeyFuncs::HashView(Text);
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const uint32* Found = Ids.FindByHash(Hash, Text))
+		{
+			OutId = *Found;
+			return true;
+		}
+		if (Strings.Num() >= MaxStrings && bWarnedFull) return false;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	if (const uint32* Found = Ids.FindByHash(Hash, Text))
+	{
+		OutId = *Found;
+		return true;
+	}
+	if (Strings.Num() >= MaxStrings)
+	{
+		if (!bWarnedFull)
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("String table full at %d entries; new event names and meta keys are no longer interned"), MaxStrings);
+			bWarnedFull = true;
+		}
+		return false;
+	}
+
+	OutId = static_cast<uint32>(Strings.Num());
+	Strings.Add(MakeUnique<FString>(Text));
+	Ids.AddByHash(Hash, *Strings.Last(), OutId);
+	return true;
+}
+
+const FString& FAbxrAtomTable::Resolve(const uint32 Id) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Strings.IsValidIndex(Id) ? *Strings[Id] : *Strings[0];
+}
+
+int32 FAbxrAtomTable::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Strings.Num();
+}
+
+FAbxrAtom::FAbxrAtom(const FStringView Text)
+{
+	if (!FAbxrAtomTable::Get().Intern(Text, Id))
+	{
+		Id = UninternedId;
+		Uninterned = MakeShared<const FString, ESPMode::ThreadSafe>(Text);
+	}
+}
+
+const FString& FAbxrAtom::ToString() const
+{
+	return Uninterned.IsValid() ? *Uninterned : FAbxrAtomTable::Get().Resolve(Id);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+/**
+ * Process-wide, case-sensitive string intern table behind FAbxrAtom.
+ * Strings are never released, so it is meant for keys and names (meta keys, event and scene names),
+ * not for free-form values. Callers can pass any name, so the table stops growing at MaxStrings;
+ * later strings are left uninterned. Id 0 is always the empty string.
+ */
+class FAbxrAtomTable
+{
+public:
+	static FAbxrAtomTable& Get();
+
+	// False when Text is not in the table and the table is full
+	bool Intern(FStringView Text, uint32& OutId);
+	const FString& Resolve(uint32 Id) const;
+	int32 Num() const;
+
+private:
+	FAbxrAtomTable();
+
+	struct FKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, uint32>& Pair) { return Pair.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static bool Matches(const FString& A, const FStringView B) { return FStringView(A).Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return HashView(Key); }
+		static uint32 HashView(const FStringView View) { return FCrc::MemCrc32(View.GetData(), View.Len() * sizeof(TCHAR)); }
+	};
+
+	mutable FRWLock Lock;
+	TMap<FString, uint32, FDefaultSetAllocator, FKeyFuncs> Ids;
+	// Boxed so references handed out by Resolve survive the array growing
+	TArray<TUniquePtr<FString>> Strings;
+	bool bWarnedFull = false;
+
+	// Far more distinct names and meta keys than an app sends on purpose; a few hundred KB at most
+	static constexpr int32 MaxStrings = 8192;
+};
@@ -0,0 +1,254 @@
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "JsonObjectConverter.h"
+#include "Services/Data/AbxrDataEncoder.h"
+#include "Services/Platform/XRDM/XRDMService.h"
+#include "Types/AbxrLog.h"
+#include "Types/AbxrTypes.h"
+#include "Util/AbxrAtomTable.h"
+#include "Util/AbxrCrc32.h"
+
+// Development-only microbenchmarks, run from the console: Abxr.Bench.<Name> [Iterations]
+
+// Module info plus a couple of Register()ed keys, as UAbxrSubsystem::MergeSuperMetaData would produce them
+static TMap<FString, FString> MakeBenchSharedMeta()
+{
+	TMap<FString, FString> Meta;
+	Meta.Add(TEXT("module"), TEXT("fire_safety_basics"));
+	Meta.Add(TEXT("moduleName"), TEXT("Fire Safety Basics"));
+	Meta.Add(TEXT("moduleId"), TEXT("3f2c8a1e-5b7d-4e0a-9c61-2d8f4b7a9e03"));
+	Meta.Add(TEXT("moduleOrder"), TEXT("1"));
+	Meta.Add(TEXT("cohort"), TEXT("2024-Q3"));
+	Meta.Add(TEXT("site"), TEXT("Building 7"));
+	return Meta;
+}
+
+static TMap<FString, FString> MakeBenchMeta()
+{
+	TMap<FString, FString> Meta;
+	Meta.Add(TEXT("x"), TEXT("1.2345"));
+	Meta.Add(TEXT("y"), TEXT("0.5000"));
+	Meta.Add(TEXT("z"), TEXT("-3.1400"));
+	return Meta;
+}
+
+static TArray<FAbxrDataEntry> MakeBenchEntries(const int32 Count)
+{
+	const FAbxrSharedMetaPtr SharedMeta = MakeShared<TArray<FAbxrMetaPair>, ESPMode::ThreadSafe>(FAbxrMetaPair::FromMap(MakeBenchSharedMeta()));
+	const TMap<FString, FString> Meta = MakeBenchMeta();
+
+	TArray<FAbxrDataEntry> Entries;
+	Entries.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FAbxrDataEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Seq = i + 1;
+		Entry.Kind = static_cast<EAbxrDataKind>(i % 3);
+		Entry.TimestampMs = 1700000000000 + i;
+		if (Entry.Kind == EAbxrDataKind::Log)
+		{
+			Entry.LogLevel = FAbxrAtom(TEXT("info"));
+			Entry.Text = TEXT("Player \"1\" entered zone\tA");
+		}
+		else
+		{
+			Entry.Name = FAbxrAtom(TEXT("headset_position"));
+		}
+		Entry.Scene = FAbxrAtom(TEXT("Lobby"));
+		Entry.Meta = FAbxrMetaPair::FromMap(Meta);
+		Entry.SharedMeta = SharedMeta;
+	}
+	return Entries;
+}
+
+// The single map every entry used to carry: caller meta, "Scene Name", then module info and super metadata
+static TMap<FString, FString> FlattenMeta(const FAbxrDataEntry& Entry)
+{
+	TMap<FString, FString> Meta;
+	for (const FAbxrMetaPair& Pair : Entry.Meta) Meta.Add(Pair.Key.ToString(), Pair.Value);
+	Meta.Add(TEXT("Scene Name"), Entry.Scene.ToString());
+	if (Entry.SharedMeta.IsValid())
+	{
+		for (const FAbxrMetaPair& Pair : *Entry.SharedMeta)
+		{
+			if (!Meta.Contains(Pair.Key.ToString())) Meta.Add(Pair.Key.ToString(), Pair.Value);
+		}
+	}
+	return Meta;
+}
+
+// The path FAbxrDataService used before FAbxrDataEncoder: reflection into an FString, then UTF-8
+static int32 EncodeWithJsonObjectConverter(const TArray<FAbxrDataEntry>& Entries)
+{
+	FAbxrDataPayloadWrapper Wrapper;
+	for (const FAbxrDataEntry& Entry : Entries)
+	{
+		const FString Timestamp = FString::Printf(TEXT("%lld"), Entry.TimestampMs);
+		switch (Entry.Kind)
+		{
+		case EAbxrDataKind::Event:
+			{
+				FAbxrEventPayload& Payload = Wrapper.event.AddDefaulted_GetRef();
+				Payload.preciseTimestamp = Timestamp;
+				Payload.name = Entry.Name.ToString();
+				Payload.meta = FlattenMeta(Entry);
+				break;
+			}
+		case EAbxrDataKind::Telemetry:
+			{
+				FAbxrTelemetryPayload& Payload = Wrapper.telemetry.AddDefaulted_GetRef();
+				Payload.preciseTimestamp = Timestamp;
+				Payload.name = Entry.Name.ToString();
+				Payload.meta = FlattenMeta(Entry);
+				break;
+			}
+		case EAbxrDataKind::Log:
+			{
+				FAbxrLogPayload& Payload = Wrapper.basicLog.AddDefaulted_GetRef();
+				Payload.preciseTimestamp = Timestamp;
+				Payload.logLevel = Entry.LogLevel.ToString();
+				Payload.text = Entry.Text;
+				Payload.meta = FlattenMeta(Entry);
+				break;
+			}
+		}
+	}
+
+	FString Json;
+	FJsonObjectConverter::UStructToJsonObjectString(FAbxrDataPayloadWrapper::StaticStruct(), &Wrapper, Json, 0, 0, 0, nullptr, false);
+	const FTCHARToUTF8 Utf8(*Json);
+	return Utf8.Length();
+}
+
+static FAutoConsoleCommand GAbxrBenchEncodeCommand(
+	TEXT("Abxr.Bench.Encode"),
+	TEXT("Times /v1/collect/data serialization of 1000 entries: FJsonObjectConverter vs FAbxrDataEncoder"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 50;
+		const TArray<FAbxrDataEntry> Entries = MakeBenchEntries(1000);
+
+		int32 ReflectedBytes = 0;
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i) ReflectedBytes = EncodeWithJsonObjectConverter(Entries);
+		const double ReflectedMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		FAbxrDataEncoder Encoder;
+		TArray<uint8> Body;
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i) Encoder.Encode(Entries, Body);
+		const double StreamedMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		TArray<uint8> CommonMetaBody;
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i) Encoder.Encode(Entries, CommonMetaBody, true);
+		const double CommonMetaMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		UE_LOG(LogAbxrLib, Display, TEXT("Abxr.Bench.Encode (1k entries, %d iterations): FJsonObjectConverter %.3f ms / %d bytes, FAbxrDataEncoder %.3f ms / %d bytes (%.1fx), with commonMeta %.3f ms / %d bytes"),
+			Iterations, ReflectedMs, ReflectedBytes, StreamedMs, Body.Num(), StreamedMs > 0.0 ? ReflectedMs / StreamedMs : 0.0, CommonMetaMs, CommonMetaBody.Num());
+	}));
+
+// How FAbxrDataEntry looked before names, scene and meta keys were interned and shared meta was referenced
+struct FLegacyBenchEntry
+{
+	uint64 Seq = 0;
+	EAbxrDataKind Kind = EAbxrDataKind::Event;
+	int64 TimestampMs = 0;
+	FString Name;
+	FString LogLevel;
+	FString Text;
+	TMap<FString, FString> Meta;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Name.GetAllocatedSize() + LogLevel.GetAllocatedSize() + Text.GetAllocatedSize() + Meta.GetAllocatedSize();
+		for (const TPair<FString, FString>& Pair : Meta) Size += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+		return Size;
+	}
+};
+
+static FAutoConsoleCommand GAbxrBenchEntryMemoryCommand(
+	TEXT("Abxr.Bench.EntryMemory"),
+	TEXT("Measures the memory held by a queued backlog (default 10000 entries): per-entry string maps vs interned entries"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const TArray<FAbxrDataEntry> Entries = MakeBenchEntries(Count);
+
+		TArray<FLegacyBenchEntry> LegacyEntries;
+		LegacyEntries.Reserve(Count);
+		for (const FAbxrDataEntry& Entry : Entries)
+		{
+			FLegacyBenchEntry& Legacy = LegacyEntries.AddDefaulted_GetRef();
+			Legacy.Seq = Entry.Seq;
+			Legacy.Kind = Entry.Kind;
+			Legacy.TimestampMs = Entry.TimestampMs;
+			Legacy.Name = Entry.Name.ToString();
+			Legacy.LogLevel = Entry.LogLevel.ToString();
+			Legacy.Text = Entry.Text;
+			Legacy.Meta = FlattenMeta(Entry);
+		}
+
+		SIZE_T LegacyBytes = LegacyEntries.GetAllocatedSize();
+		for (const FLegacyBenchEntry& Legacy : LegacyEntries) LegacyBytes += Legacy.GetAllocatedSize();
+
+		// The shared meta array is counted once, since every entry references the same one
+		SIZE_T InternedBytes = Entries.GetAllocatedSize() + Entries[0].SharedMeta->GetAllocatedSize();
+		for (const FAbxrMetaPair& Pair : *Entries[0].SharedMeta) InternedBytes += Pair.Value.GetAllocatedSize();
+		for (const FAbxrDataEntry& Entry : Entries) InternedBytes += Entry.GetAllocatedSize();
+
+		UE_LOG(LogAbxrLib, Display, TEXT("Abxr.Bench.EntryMemory (%d entries): string maps %.1f KB (%llu B/entry), interned %.1f KB (%llu B/entry), %d atoms"),
+			Count, LegacyBytes / 1024.0, static_cast<uint64>(LegacyBytes / Count), InternedBytes / 1024.0, static_cast<uint64>(InternedBytes / Count),
+			FAbxrAtomTable::Get().Num());
+	}));
+
+static FAutoConsoleCommand GAbxrBenchCRC32Command(
+	TEXT("Abxr.Bench.CRC32"),
+	TEXT("Throughput of the request-signing CRC32 over an encoded backlog flush (default 4 MB): byte table vs slicing-by-8 vs the dispatched path"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 SizeMB = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 256) : 4;
+		constexpr int32 Iterations = 20;
+
+		// A real body rather than random bytes, repeated up to the requested size
+		FAbxrDataEncoder Encoder;
+		TArray<uint8> Chunk;
+		Encoder.Encode(MakeBenchEntries(1000), Chunk);
+		TArray<uint8> Body;
+		Body.Reserve(SizeMB * 1024 * 1024 + Chunk.Num());
+		while (Body.Num() < SizeMB * 1024 * 1024) Body.Append(Chunk);
+
+		const auto Time = [&Body](uint32 (*Fn)(const uint8*, int64, uint32), uint32& OutCrc)
+		{
+			const double Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i) OutCrc = Fn(Body.GetData(), Body.Num(), 0);
+			const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+			return Ms;
+		};
+
+		uint32 BytewiseCrc = 0, SlicingCrc = 0, DispatchCrc = 0;
+		const double BytewiseMs = Time(&FAbxrCrc32::ComputeBytewise, BytewiseCrc);
+		const double SlicingMs = Time(&FAbxrCrc32::ComputeSlicingBy8, SlicingCrc);
+		const double DispatchMs = Time(&FAbxrCrc32::Compute, DispatchCrc);
+		const double MB = Body.Num() / (1024.0 * 1024.0);
+
+		UE_LOG(LogAbxrLib, Display, TEXT("Abxr.Bench.CRC32 (%.1f MB): byte table %.3f ms (%.0f MB/s), slicing-by-8 %.3f ms (%.0f MB/s), %s %.3f ms (%.0f MB/s)%s"),
+			MB, BytewiseMs, MB * 1000.0 / BytewiseMs, SlicingMs, MB * 1000.0 / SlicingMs,
+			FAbxrCrc32::GetImplementationName(), DispatchMs, MB * 1000.0 / DispatchMs,
+			BytewiseCrc == SlicingCrc && BytewiseCrc == DispatchCrc ? TEXT("") : TEXT(" MISMATCH"));
+	}));
+
+#if PLATFORM_ANDROID
+static FAutoConsoleCommand GAbxrBenchXRDMCommand(
+	TEXT("Abxr.Bench.XRDM"),
+	TEXT("Calls per second for an XRDM SDK getter: per-call JNI lookups vs the pre-resolved binding table"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UXRDMService::RunJNIBenchmark(Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000);
+	}));
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+#include "AbxrCrc32.h"
+#if PLATFORM_CPU_X86_FAMILY
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#elif PLATFORM_ANDROID && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#define ABXR_CRC32_ARMV8 1
+#endif
+
+#ifndef ABXR_CRC32_ARMV8
+#define ABXR_CRC32_ARMV8 0
+#endif
+
+// MSVC exposes every intrinsic unconditionally; clang and gcc need the feature enabled per function
+#if defined(__clang__) || defined(__GNUC__)
+#define ABXR_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#define ABXR_TARGET_CRC __attribute__((target("crc")))
+#else
+#define ABXR_TARGET_PCLMUL
+#define ABXR_TARGET_CRC
+#endif
+
+static constexpr uint32 CRC32Table[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA,
+    0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+    0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE,
+    0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC,
+    0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+    0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940,
+    0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116,
+    0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+    0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A,
+    0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818,
+    0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+    0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C,
+    0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2,
+    0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+    0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086,
+    0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4,
+    0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+    0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8,
+    0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE,
+    0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+    0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252,
+    0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60,
+    0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+    0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04,
+    0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A,
+    0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+    0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E,
+    0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C,
+    0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+    0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0,
+    0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6,
+    0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+    0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+// Tables[k][i] is the CRC of byte i followed by k zero bytes, so eight bytes fold in one step
+struct FCrc32SlicingTables
+{
+	uint32 Tables[8][256];
+
+	FCrc32SlicingTables()
+	{
+		for (int32 i = 0; i < 256; ++i) Tables[0][i] = CRC32Table[i];
+		for (int32 k = 1; k < 8; ++k)
+		{
+			for (int32 i = 0; i < 256; ++i)
+			{
+				Tables[k][i] = (Tables[k - 1][i] >> 8) ^ CRC32Table[Tables[k - 1][i] & 0xFF];
+			}
+		}
+	}
+};
+
+static const FCrc32SlicingTables& GetSlicingTables()
+{
+	static const FCrc32SlicingTables Tables;
+	return Tables;
+}
+
+// The helpers below work on the running register (the inverted CRC); the public entry points do the inversion
+static uint32 UpdateBytewise(uint32 State, const uint8* Data, int64 Length)
+{
+	for (int64 i = 0; i < Length; ++i)
+	{
+		State = (State >> 8) ^ CRC32Table[(State ^ Data[i]) & 0xFF];
+	}
+	return State;
+}
+
+static uint32 UpdateSlicingBy8(uint32 State, const uint8* Data, int64 Length)
+{
+	const uint32 (&T)[8][256] = GetSlicingTables().Tables;
+	while (Length >= 8)
+	{
+		// Both supported platforms are little-endian
+		uint32 One, Two;
+		FMemory::Memcpy(&One, Data, 4);
+		FMemory::Memcpy(&Two, Data + 4, 4);
+		One ^= State;
+		State = T[7][One & 0xFF] ^ T[6][(One >> 8) & 0xFF] ^ T[5][(One >> 16) & 0xFF] ^ T[4][One >> 24] ^
+			T[3][Two & 0xFF] ^ T[2][(Two >> 8) & 0xFF] ^ T[1][(Two >> 16) & 0xFF] ^ T[0][Two >> 24];
+		Data += 8;
+		Length -= 8;
+	}
+	return UpdateBytewise(State, Data, Length);
+}
+
+#if PLATFORM_CPU_X86_FAMILY
+// A lambda would not inherit the target attribute, so this is a function of its own
+ABXR_TARGET_PCLMUL static FORCEINLINE __m128i FoldLane(const __m128i Acc, const __m128i Next, const __m128i K)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Acc, K, 0x11), Next), _mm_clmulepi64_si128(Acc, K, 0x00));
+}
+
+// Carry-less multiply folding, after Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ".
+// Folds four 16-byte lanes per 64 bytes, then to one lane, then Barrett-reduces to 32 bits. Length >= 64, multiple of 16.
+ABXR_TARGET_PCLMUL static uint32 UpdatePclmulBlocks(const uint32 State, const uint8* Data, int64 Length)
+{
+	const __m128i K1K2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	const __m128i K3K4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	const __m128i K5K0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+	const __m128i Poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+	const __m128i Mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	__m128i X1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x00));
+	__m128i X2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x10));
+	__m128i X3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x20));
+	__m128i X4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x30));
+	X1 = _mm_xor_si128(X1, _mm_cvtsi32_si128(static_cast<int32>(State)));
+	Data += 64;
+	Length -= 64;
+
+	while (Length >= 64)
+	{
+		const __m128i X5 = _mm_clmulepi64_si128(X1, K1K2, 0x00);
+		const __m128i X6 = _mm_clmulepi64_si128(X2, K1K2, 0x00);
+		const __m128i X7 = _mm_clmulepi64_si128(X3, K1K2, 0x00);
+		const __m128i X8 = _mm_clmulepi64_si128(X4, K1K2, 0x00);
+		X1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(X1, K1K2, 0x11), X5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x00)));
+		X2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(X2, K1K2, 0x11), X6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x10)));
+		X3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(X3, K1K2, 0x11), X7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x20)));
+		X4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(X4, K1K2, 0x11), X8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + 0x30)));
+		Data += 64;
+		Length -= 64;
+	}
+
+	// Four lanes into one
+	X1 = FoldLane(X1, X2, K3K4);
+	X1 = FoldLane(X1, X3, K3K4);
+	X1 = FoldLane(X1, X4, K3K4);
+	while (Length >= 16)
+	{
+		X1 = FoldLane(X1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)), K3K4);
+		Data += 16;
+		Length -= 16;
+	}
+
+	// 128 bits to 64
+	__m128i Tmp = _mm_clmulepi64_si128(X1, K3K4, 0x10);
+	X1 = _mm_xor_si128(_mm_srli_si128(X1, 8), Tmp);
+	Tmp = _mm_srli_si128(X1, 4);
+	X1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(X1, Mask32), K5K0, 0x00), Tmp);
+
+	// Barrett reduction to 32 bits
+	Tmp = _mm_clmulepi64_si128(_mm_and_si128(X1, Mask32), Poly, 0x10);
+	Tmp = _mm_clmulepi64_si128(_mm_and_si128(Tmp, Mask32), Poly, 0x00);
+	X1 = _mm_xor_si128(X1, Tmp);
+	return static_cast<uint32>(_mm_extract_epi32(X1, 1));
+}
+
+static uint32 UpdatePclmul(uint32 State, const uint8* Data, int64 Length)
+{
+	if (Length >= 64)
+	{
+		const int64 Blocks = Length & ~static_cast<int64>(15);
+		State = UpdatePclmulBlocks(State, Data, Blocks);
+		Data += Blocks;
+		Length -= Blocks;
+	}
+	return UpdateSlicingBy8(State, Data, Length);
+}
+
+static bool HasPclmul()
+{
+	// CPUID leaf 1, ECX: bit 1 PCLMULQDQ, bit 19 SSE4.1
+#if defined(_MSC_VER) && !defined(__clang__)
+	int Regs[4];
+	__cpuid(Regs, 1);
+	const uint32 Ecx = static_cast<uint32>(Regs[2]);
+#else
+	unsigned int Eax, Ebx, Ecx, Edx;
+	if (!__get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx)) return false;
+#endif
+	return (Ecx & (1u << 1)) && (Ecx & (1u << 19));
+}
+#endif
+
+#if ABXR_CRC32_ARMV8
+ABXR_TARGET_CRC static uint32 UpdateArmv8(uint32 State, const uint8* Data, int64 Length)
+{
+	while (Length > 0 && (reinterpret_cast<UPTRINT>(Data) & 7) != 0)
+	{
+		State = __crc32b(State, *Data++);
+		--Length;
+	}
+	while (Length >= 8)
+	{
+		uint64 Word;
+		FMemory::Memcpy(&Word, Data, 8);
+		State = __crc32d(State, Word);
+		Data += 8;
+		Length -= 8;
+	}
+	while (Length-- > 0) State = __crc32b(State, *Data++);
+	return State;
+}
+#endif
+
+using FCrc32UpdateFn = uint32 (*)(uint32, const uint8*, int64);
+
+struct FCrc32Dispatch
+{
+	FCrc32UpdateFn Update = &UpdateSlicingBy8;
+	const TCHAR* Name = TEXT("slicing-by-8");
+
+	FCrc32Dispatch()
+	{
+		GetSlicingTables(); // every path finishes its tail with the tables
+#if PLATFORM_CPU_X86_FAMILY
+		if (HasPclmul())
+		{
+			Update = &UpdatePclmul;
+			Name = TEXT("PCLMULQDQ");
+		}
+#elif ABXR_CRC32_ARMV8
+		if (getauxval(AT_HWCAP) & HWCAP_CRC32)
+		{
+			Update = &UpdateArmv8;
+			Name = TEXT("ARMv8 CRC32");
+		}
+#endif
+	}
+};
+
+static const FCrc32Dispatch& GetDispatch()
+{
+	static const FCrc32Dispatch Dispatch;
+	return Dispatch;
+}
+
+uint32 FAbxrCrc32::Compute(const uint8* Data, const int64 Length, const uint32 Crc)
+{
+	return ~GetDispatch().Update(~Crc, Data, Length);
+}
+
+const TCHAR* FAbxrCrc32::GetImplementationName()
+{
+	return GetDispatch().Name;
+}
+
+uint32 FAbxrCrc32::ComputeBytewise(const uint8* Data, const int64 Length, const uint32 Crc)
+{
+	return ~UpdateBytewise(~Crc, Data, Length);
+}
+
+uint32 FAbxrCrc32::ComputeSlicingBy8(const uint8* Data, const int64 Length, const uint32 Crc)
+{
+	return ~UpdateSlicingBy8(~Crc, Data, Length);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * CRC-32 (IEEE 802.3, the zlib polynomial) over raw bytes.
+ * Compute picks the fastest path the CPU supports once, on first use: PCLMULQDQ folding on x86,
+ * the ARMv8 CRC32 instructions on arm64 Android, slicing-by-8 everywhere else.
+ * Every path returns the same value, and Crc chains like zlib's crc32(): pass the previous result to continue.
+ */
+class FAbxrCrc32
+{
+public:
+	static uint32 Compute(const uint8* Data, int64 Length, uint32 Crc = 0);
+	static const TCHAR* GetImplementationName();
+
+	// Fixed paths, for the benchmark
+	static uint32 ComputeBytewise(const uint8* Data, int64 Length, uint32 Crc = 0);
+	static uint32 ComputeSlicingBy8(const uint8* Data, int64 Length, uint32 Crc = 0);
+};
+
+// Running CRC over bytes fed in pieces; Get() matches FAbxrCrc32::Compute over their concatenation
+class FAbxrCrc32Hasher
+{
+public:
+	void Reset() { Crc = 0; }
+	void Update(const uint8* Data, const int64 Length) { Crc = FAbxrCrc32::Compute(Data, Length, Crc); }
+	uint32 Get() const { return Crc; }
+
+private:
+	uint32 Crc = 0;
+};
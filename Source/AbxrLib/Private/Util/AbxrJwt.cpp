@@ -0,0 +1,224 @@
+#include "AbxrJwt.h"
+
+static int32 DecodeBase64UrlChar(const TCHAR C)
+{
+	if (C >= 'A' && C <= 'Z') return C - 'A';
+	if (C >= 'a' && C <= 'z') return C - 'a' + 26;
+	if (C >= '0' && C <= '9') return C - '0' + 52;
+	if (C == '-' || C == '+') return 62;
+	if (C == '_' || C == '/') return 63;
+	return -1;
+}
+
+bool FAbxrJwt::DecodeBase64Url(const FStringView In, TArray<uint8, TInlineAllocator<512>>& Out)
+{
+	int32 Len = In.Len();
+	while (Len > 0 && In[Len - 1] == '=') --Len;
+	if (Len % 4 == 1) return false; // a lone trailing character cannot encode a byte
+
+	Out.Reset(Len * 3 / 4);
+	uint32 Acc = 0;
+	int32 Bits = 0;
+	for (int32 i = 0; i < Len; ++i)
+	{
+		const int32 Value = DecodeBase64UrlChar(In[i]);
+		if (Value < 0) return false;
+		Acc = (Acc << 6) | static_cast<uint32>(Value);
+		Bits += 6;
+		if (Bits >= 8)
+		{
+			Bits -= 8;
+			Out.Add(static_cast<uint8>(Acc >> Bits));
+			Acc &= (1u << Bits) - 1;
+		}
+	}
+	return true;
+}
+
+bool FAbxrJwt::ReadClaims(const FStringView Token, FAbxrJwtClaims& OutClaims)
+{
+	int32 HeaderEnd;
+	if (!Token.FindChar('.', HeaderEnd)) return false;
+	const FStringView Rest = Token.RightChop(HeaderEnd + 1);
+	int32 PayloadEnd;
+	if (!Rest.FindChar('.', PayloadEnd)) PayloadEnd = Rest.Len();
+
+	TArray<uint8, TInlineAllocator<512>> Json;
+	if (!DecodeBase64Url(Rest.Left(PayloadEnd), Json)) return false;
+
+	OutClaims = FAbxrJwtClaims();
+	return ScanClaims(Json, OutClaims) && OutClaims.Exp > 0;
+}
+
+namespace
+{
+	// Forward-only cursor over the decoded payload; every read is bounds-checked
+	struct FJsonCursor
+	{
+		const uint8* Data;
+		int32 Num;
+		int32 Pos = 0;
+
+		bool AtEnd() const { return Pos >= Num; }
+		uint8 Peek() const { return Pos < Num ? Data[Pos] : 0; }
+
+		void SkipWhitespace()
+		{
+			while (Pos < Num && (Data[Pos] == ' ' || Data[Pos] == '\t' || Data[Pos] == '\n' || Data[Pos] == '\r')) ++Pos;
+		}
+
+		bool Consume(const uint8 C)
+		{
+			SkipWhitespace();
+			if (Peek() != C) return false;
+			++Pos;
+			return true;
+		}
+
+		// Positioned on the opening quote; leaves the raw (still escaped) contents in Start/Len
+		bool ReadString(int32& Start, int32& Len)
+		{
+			if (Peek() != '"') return false;
+			Start = ++Pos;
+			while (Pos < Num && Data[Pos] != '"')
+			{
+				Pos += Data[Pos] == '\\' ? 2 : 1;
+			}
+			if (Pos >= Num) return false;
+			Len = Pos++ - Start;
+			return true;
+		}
+
+		// A JSON number, optionally quoted, truncated toward zero; fractions and exponents are applied (1.7e9 reads as 1700000000)
+		bool ReadInt(int64& Out)
+		{
+			static constexpr uint64 Limit = 1000000000000000000ull;  // 19 digits would not fit every int64
+			SkipWhitespace();
+			const bool bQuoted = Peek() == '"';
+			if (bQuoted) ++Pos;
+			const bool bNegative = Peek() == '-';
+			if (bNegative) ++Pos;
+
+			// Value = Mantissa * 10^Scale
+			uint64 Mantissa = 0;
+			int32 Scale = 0;
+			int32 Digits = 0;
+			while (Pos < Num && Data[Pos] >= '0' && Data[Pos] <= '9')
+			{
+				if (++Digits > 18) return false;
+				Mantissa = Mantissa * 10 + (Data[Pos++] - '0');
+			}
+			if (Digits == 0) return false;
+
+			if (Peek() == '.')
+			{
+				++Pos;
+				int32 FractionDigits = 0;
+				while (Pos < Num && Data[Pos] >= '0' && Data[Pos] <= '9')
+				{
+					++FractionDigits;
+					// Digits past what the mantissa holds cannot move the integer part
+					if (Mantissa < Limit / 10)
+					{
+						Mantissa = Mantissa * 10 + (Data[Pos] - '0');
+						--Scale;
+					}
+					++Pos;
+				}
+				if (FractionDigits == 0) return false;
+			}
+
+			if (Pos < Num && (Data[Pos] == 'e' || Data[Pos] == 'E'))
+			{
+				++Pos;
+				const bool bNegativeExponent = Peek() == '-';
+				if (bNegativeExponent || Peek() == '+') ++Pos;
+				int32 Exponent = 0;
+				int32 ExponentDigits = 0;
+				while (Pos < Num && Data[Pos] >= '0' && Data[Pos] <= '9')
+				{
+					if (++ExponentDigits > 4) return false;
+					Exponent = Exponent * 10 + (Data[Pos++] - '0');
+				}
+				if (ExponentDigits == 0) return false;
+				Scale += bNegativeExponent ? -Exponent : Exponent;
+			}
+
+			for (; Scale > 0 && Mantissa > 0; --Scale)
+			{
+				if (Mantissa >= Limit / 10) return false;
+				Mantissa *= 10;
+			}
+			for (; Scale < 0 && Mantissa > 0; ++Scale) Mantissa /= 10;
+			if (bQuoted && !Consume('"')) return false;
+
+			Out = bNegative ? -static_cast<int64>(Mantissa) : static_cast<int64>(Mantissa);
+			return true;
+		}
+
+		// Skips any value, tracking nesting and strings so brackets inside strings do not count
+		bool SkipValue()
+		{
+			SkipWhitespace();
+			int32 Depth = 0;
+			while (Pos < Num)
+			{
+				const uint8 C = Data[Pos];
+				if (C == '"')
+				{
+					int32 Start, Len;
+					if (!ReadString(Start, Len)) return false;
+				}
+				else if (C == '{' || C == '[')
+				{
+					++Depth;
+					++Pos;
+				}
+				else if (C == '}' || C == ']')
+				{
+					if (Depth == 0) return true;
+					--Depth;
+					++Pos;
+				}
+				else if (C == ',' && Depth == 0)
+				{
+					return true;
+				}
+				else
+				{
+					++Pos;
+				}
+				if (Depth == 0 && (C == '"' || C == '}' || C == ']'))
+				{
+					SkipWhitespace();
+					return true;
+				}
+			}
+			return Depth == 0;
+		}
+	};
+}
+
+bool FAbxrJwt::ScanClaims(const TConstArrayView<uint8> Json, FAbxrJwtClaims& OutClaims)
+{
+	FJsonCursor Cursor{ Json.GetData(), Json.Num() };
+	if (!Cursor.Consume('{')) return false;
+	if (Cursor.Consume('}')) return true;
+
+	do
+	{
+		Cursor.SkipWhitespace();
+		int32 KeyStart, KeyLen;
+		if (!Cursor.ReadString(KeyStart, KeyLen) || !Cursor.Consume(':')) return false;
+
+		const uint8* Key = Json.GetData() + KeyStart;
+		int64* Target = nullptr;
+		if (KeyLen == 3 && FMemory::Memcmp(Key, "exp", 3) == 0) Target = &OutClaims.Exp;
+		else if (KeyLen == 3 && FMemory::Memcmp(Key, "iat", 3) == 0) Target = &OutClaims.Iat;
+
+		if (Target ? !Cursor.ReadInt(*Target) : !Cursor.SkipValue()) return false;
+	}
+	while (Cursor.Consume(','));
+
+	return Cursor.Consume('}');
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "CoreMinimal.h"
+
+struct FAbxrJwtClaims
+{
+	int64 Exp = 0;
+	int64 Iat = 0;
+};
+
+/**
+ * Reads the numeric claims the auth service needs from a JWT without splitting the token,
+ * building intermediate strings or a JSON DOM. The signature is not checked: the claims
+ * are only used to decide when to re-authenticate.
+ */
+class FAbxrJwt
+{
+public:
+	// True when the payload decodes, is a well-formed JSON object and carries a positive exp
+	static bool ReadClaims(FStringView Token, FAbxrJwtClaims& OutClaims);
+	// Padded or unpadded base64url (standard base64 characters are accepted too); false on anything else
+	static bool DecodeBase64Url(FStringView In, TArray<uint8, TInlineAllocator<512>>& Out);
+
+private:
+	static bool ScanClaims(TConstArrayView<uint8> Json, FAbxrJwtClaims& OutClaims);
+};
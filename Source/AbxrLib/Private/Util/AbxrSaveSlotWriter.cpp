@@ -0,0 +1,60 @@
+#include "AbxrSaveSlotWriter.h"
+#include "Async/Async.h"
+#include "Kismet/GameplayStatics.h"
+#include "Types/AbxrLog.h"
+
+FAbxrSaveSlotWriter::FAbxrSaveSlotWriter(const FString& InSlotName, const int32 InUserIndex)
+	: SlotName(InSlotName)
+	, UserIndex(InUserIndex)
+	, IdleEvent(FPlatformProcess::GetSynchEventFromPool(true))
+{
+	IdleEvent->Trigger();
+}
+
+FAbxrSaveSlotWriter::~FAbxrSaveSlotWriter()
+{
+	FPlatformProcess::ReturnSynchEventToPool(IdleEvent);
+	IdleEvent = nullptr;
+}
+
+void FAbxrSaveSlotWriter::Write(TArray<uint8>&& Bytes)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		Pending = MoveTemp(Bytes);
+		if (bWriting) return;
+		bWriting = true;
+		IdleEvent->Reset();
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Self = AsShared()] { Self->Drain(); });
+}
+
+void FAbxrSaveSlotWriter::Wait() const
+{
+	IdleEvent->Wait();
+}
+
+void FAbxrSaveSlotWriter::Drain()
+{
+	for (;;)
+	{
+		TArray<uint8> Bytes;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (!Pending.IsSet())
+			{
+				bWriting = false;
+				IdleEvent->Trigger();
+				return;
+			}
+			Bytes = MoveTemp(Pending.GetValue());
+			Pending.Reset();
+		}
+
+		if (!UGameplayStatics::SaveDataToSlot(Bytes, SlotName, UserIndex))
+		{
+			UE_LOG(LogAbxrLib, Warning, TEXT("Failed to write save slot '%s'"), *SlotName);
+		}
+	}
+}
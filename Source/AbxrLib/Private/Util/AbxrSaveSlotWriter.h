@@ -0,0 +1,29 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+
+/**
+ * Writes serialized save-game bytes to a slot on a pool thread, one write at a time.
+ * Writes queued while one is running coalesce: only the newest bytes are written next.
+ */
+class FAbxrSaveSlotWriter : public TSharedFromThis<FAbxrSaveSlotWriter, ESPMode::ThreadSafe>
+{
+public:
+	FAbxrSaveSlotWriter(const FString& InSlotName, int32 InUserIndex);
+	~FAbxrSaveSlotWriter();
+
+	void Write(TArray<uint8>&& Bytes);
+	// Blocks until every queued write has reached the slot
+	void Wait() const;
+
+private:
+	void Drain();
+
+	const FString SlotName;
+	const int32 UserIndex;
+
+	FCriticalSection Lock;
+	TOptional<TArray<uint8>> Pending;
+	bool bWriting = false;
+	FEvent* IdleEvent = nullptr;
+};
@@ -0,0 +1,151 @@
+#include "AbxrSecureFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+THIRD_PARTY_INCLUDES_START
+#define UI UI_ST
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+#undef UI
+THIRD_PARTY_INCLUDES_END
+
+#if PLATFORM_ANDROID
+// The app's internal files directory, set up by the Android platform file layer
+extern FString GInternalFilePath;
+#endif
+
+// Also authenticated as additional data, so a file from a future layout is rejected rather than misread
+static constexpr uint8 SecureFileMagic[] = { 'A', 'B', 'X', '1' };
+
+FString FAbxrSecureFile::GetInstallSecretPath()
+{
+#if PLATFORM_ANDROID
+	// Saved/ can sit on shared external storage; internal storage is readable by this app only
+	return FPaths::Combine(GInternalFilePath, TEXT("AbxrLib"), TEXT("Key.bin"));
+#else
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AbxrLib"), TEXT("Key.bin"));
+#endif
+}
+
+bool FAbxrSecureFile::GetInstallSecret(uint8 (&OutSecret)[32])
+{
+	// Read or created once per run; Save and Load are called from worker threads
+	static FCriticalSection Lock;
+	static uint8 Secret[32];
+	static bool bReady = false;
+
+	FScopeLock ScopeLock(&Lock);
+	if (!bReady)
+	{
+		const FString Path = GetInstallSecretPath();
+		TArray<uint8> Stored;
+		if (FFileHelper::LoadFileToArray(Stored, *Path, FILEREAD_Silent) && Stored.Num() == sizeof(Secret))
+		{
+			FMemory::Memcpy(Secret, Stored.GetData(), sizeof(Secret));
+			FPlatformMemory::Memzero(Stored.GetData(), Stored.Num());
+		}
+		else
+		{
+			// First run, or the secret was lost: anything encrypted under the old one simply stops loading
+			if (RAND_bytes(Secret, sizeof(Secret)) != 1) return false;
+			if (!FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Secret, sizeof(Secret)), *Path)) return false;
+		}
+		bReady = true;
+	}
+	FMemory::Memcpy(OutSecret, Secret, sizeof(Secret));
+	return true;
+}
+
+bool FAbxrSecureFile::DeriveKey(const FString& Context, uint8 (&OutKey)[32])
+{
+	uint8 Secret[32];
+	if (!GetInstallSecret(Secret)) return false;
+
+	const FTCHARToUTF8 ContextUtf8(*Context);
+	SHA256_CTX Sha;
+	SHA256_Init(&Sha);
+	SHA256_Update(&Sha, Secret, sizeof(Secret));
+	SHA256_Update(&Sha, ContextUtf8.Get(), ContextUtf8.Length());
+	SHA256_Final(OutKey, &Sha);
+	FPlatformMemory::Memzero(Secret, sizeof(Secret));
+	return true;
+}
+
+bool FAbxrSecureFile::Save(const FString& Path, const FString& Plaintext, const FString& Context)
+{
+	static_assert(sizeof(SecureFileMagic) == MagicSize, "Magic size mismatch");
+
+	const FTCHARToUTF8 Utf8(*Plaintext);
+	TArray<uint8> Out;
+	Out.SetNumUninitialized(HeaderSize + Utf8.Length());
+	FMemory::Memcpy(Out.GetData(), SecureFileMagic, MagicSize);
+	uint8* IV = Out.GetData() + MagicSize;
+	uint8* Tag = IV + IVSize;
+	uint8* Ciphertext = Tag + TagSize;
+	if (RAND_bytes(IV, IVSize) != 1) return false;
+
+	uint8 Key[32];
+	if (!DeriveKey(Context, Key)) return false;
+
+	EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+	int Len = 0;
+	int FinalLen = 0;
+	const bool bOk = Ctx
+		&& EVP_EncryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1
+		&& EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_IVLEN, IVSize, nullptr) == 1
+		&& EVP_EncryptInit_ex(Ctx, nullptr, nullptr, Key, IV) == 1
+		&& EVP_EncryptUpdate(Ctx, nullptr, &Len, SecureFileMagic, MagicSize) == 1
+		&& EVP_EncryptUpdate(Ctx, Ciphertext, &Len, reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()) == 1
+		&& EVP_EncryptFinal_ex(Ctx, Ciphertext + Len, &FinalLen) == 1
+		&& EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_GET_TAG, TagSize, Tag) == 1;
+	EVP_CIPHER_CTX_free(Ctx);
+	FPlatformMemory::Memzero(Key, sizeof(Key));
+
+	return bOk && FFileHelper::SaveArrayToFile(Out, *Path);
+}
+
+bool FAbxrSecureFile::Load(const FString& Path, const FString& Context, FString& OutPlaintext)
+{
+	TArray<uint8> In;
+	if (!FFileHelper::LoadFileToArray(In, *Path, FILEREAD_Silent)) return false;
+	if (In.Num() < HeaderSize || FMemory::Memcmp(In.GetData(), SecureFileMagic, MagicSize) != 0) return false;
+
+	const uint8* IV = In.GetData() + MagicSize;
+	const uint8* Tag = IV + IVSize;
+	const uint8* Ciphertext = Tag + TagSize;
+	const int32 CiphertextSize = In.Num() - HeaderSize;
+
+	uint8 Key[32];
+	if (!DeriveKey(Context, Key)) return false;
+
+	// One spare byte keeps the output pointer non-null for an empty payload; a null output means AAD to OpenSSL
+	TArray<uint8> Plain;
+	Plain.SetNumUninitialized(CiphertextSize + 1);
+	EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+	int Len = 0;
+	int FinalLen = 0;
+	// Final fails when the tag does not match: another install, wrong app token or a damaged file
+	const bool bOk = Ctx
+		&& EVP_DecryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1
+		&& EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_IVLEN, IVSize, nullptr) == 1
+		&& EVP_DecryptInit_ex(Ctx, nullptr, nullptr, Key, IV) == 1
+		&& EVP_DecryptUpdate(Ctx, nullptr, &Len, SecureFileMagic, MagicSize) == 1
+		&& EVP_DecryptUpdate(Ctx, Plain.GetData(), &Len, Ciphertext, CiphertextSize) == 1
+		&& EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_TAG, TagSize, const_cast<uint8*>(Tag)) == 1
+		&& EVP_DecryptFinal_ex(Ctx, Plain.GetData() + Len, &FinalLen) == 1;
+	EVP_CIPHER_CTX_free(Ctx);
+	FPlatformMemory::Memzero(Key, sizeof(Key));
+	if (!bOk) return false;
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Plain.GetData()), CiphertextSize);
+	OutPlaintext = FString(Converted.Length(), Converted.Get());
+	FPlatformMemory::Memzero(Plain.GetData(), Plain.Num());
+	return true;
+}
+
+void FAbxrSecureFile::Delete(const FString& Path)
+{
+	IFileManager::Get().Delete(*Path, false, false, true);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Small files encrypted at rest with AES-256-GCM.
+ * The key is derived from a random per-install secret kept in the app's private storage and a caller-supplied
+ * context (the app token). A file copied off the device, or out of shared storage, does not decrypt without that
+ * secret; anyone who can read the app's private storage (a rooted device) can. Tampered or truncated files fail to load.
+ */
+class FAbxrSecureFile
+{
+public:
+	static bool Save(const FString& Path, const FString& Plaintext, const FString& Context);
+	static bool Load(const FString& Path, const FString& Context, FString& OutPlaintext);
+	static void Delete(const FString& Path);
+
+private:
+	// False when the install secret can neither be read nor created
+	static bool DeriveKey(const FString& Context, uint8 (&OutKey)[32]);
+	static bool GetInstallSecret(uint8 (&OutSecret)[32]);
+	static FString GetInstallSecretPath();
+
+	// File layout: Magic | IV | Tag | Ciphertext
+	static constexpr int32 MagicSize = 4;
+	static constexpr int32 IVSize = 12;
+	static constexpr int32 TagSize = 16;
+	static constexpr int32 HeaderSize = MagicSize + IVSize + TagSize;
+};
@@ -0,0 +1,62 @@
+#include "AbxrSha256.h"
+#include "Misc/Base64.h"
+THIRD_PARTY_INCLUDES_START
+#define UI UI_ST
+#include <openssl/evp.h>
+#undef UI
+THIRD_PARTY_INCLUDES_END
+
+FAbxrSha256::FAbxrSha256()
+	: Ctx(EVP_MD_CTX_new())
+{
+	Reset();
+}
+
+FAbxrSha256::~FAbxrSha256()
+{
+	EVP_MD_CTX_free(Ctx);
+}
+
+void FAbxrSha256::Reset()
+{
+	EVP_DigestInit_ex(Ctx, EVP_sha256(), nullptr);
+}
+
+void FAbxrSha256::Update(const uint8* Data, const int64 Length)
+{
+	EVP_DigestUpdate(Ctx, Data, Length);
+}
+
+void FAbxrSha256::Update(const FStringView Text)
+{
+	// Tokens, secrets and timestamps are ASCII, so this is almost always a straight narrowing copy
+	uint8 Buffer[256];
+	int32 Used = 0;
+	for (int32 i = 0; i < Text.Len(); ++i)
+	{
+		const TCHAR C = Text[i];
+		if (C >= 0x80)
+		{
+			Update(Buffer, Used);
+			const FTCHARToUTF8 Rest(Text.GetData() + i, Text.Len() - i);
+			Update(reinterpret_cast<const uint8*>(Rest.Get()), Rest.Length());
+			return;
+		}
+		Buffer[Used++] = static_cast<uint8>(C);
+		if (Used == UE_ARRAY_COUNT(Buffer))
+		{
+			Update(Buffer, Used);
+			Used = 0;
+		}
+	}
+	Update(Buffer, Used);
+}
+
+FString FAbxrSha256::FinalizeBase64()
+{
+	uint8 Digest[EVP_MAX_MD_SIZE];
+	unsigned int DigestLength = 0;
+	EVP_DigestFinal_ex(Ctx, Digest, &DigestLength);
+	Reset();
+	return FBase64::Encode(Digest, DigestLength);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "CoreMinimal.h"
+
+struct evp_md_ctx_st;
+
+/**
+ * Incremental SHA-256 on one OpenSSL digest context that is reset, not reallocated, between hashes.
+ * Not thread-safe; keep one per thread.
+ */
+class FAbxrSha256
+{
+public:
+	FAbxrSha256();
+	~FAbxrSha256();
+	FAbxrSha256(const FAbxrSha256&) = delete;
+	FAbxrSha256& operator=(const FAbxrSha256&) = delete;
+
+	void Reset();
+	void Update(const uint8* Data, int64 Length);
+	// Hashes the UTF-8 form of Text, converting through a stack buffer
+	void Update(FStringView Text);
+	// Ends the hash and returns the digest as base64, like FAbxrUtil::ComputeSHA256
+	FString FinalizeBase64();
+
+private:
+	evp_md_ctx_st* Ctx = nullptr;
+};
@@ -6,6 +6,7 @@ class FAbxrUtil
 public:
 	static FString ComputeSHA256(const FString& Input);
 	static uint32 ComputeCRC32(const FString& Input);
+	static uint32 ComputeCRC32(const uint8* Data, int64 Length);
 	static FString CombineUrl(const FString& Base, const FString& Path);
 	static bool IsValidUrl(const FString& InUrl);
 	static bool IsPackageInstalled(const FString& PackageName);
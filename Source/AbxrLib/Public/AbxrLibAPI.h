@@ -1,6 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Types/AbxrPublicTypes.h"
+#include "AbxrTelemetryProvider.h"
 
 namespace Abxr
 {
@@ -57,6 +58,9 @@ namespace Abxr
 	
 	ABXRLIB_API void Telemetry(const FString& Name, TMap<FString, FString>& Meta);
 	ABXRLIB_API void Telemetry(const FString& Name);
+	// Typed telemetry for high-frequency samples: keys are interned atoms and values are formatted at send time,
+	// so recording a sample of up to 10 fields does not allocate. Create the atoms once (e.g. as statics) and reuse them.
+	ABXRLIB_API void TelemetryTyped(const FAbxrAtom& Name, TConstArrayView<FAbxrTelemetryField> Fields);
 	
 	ABXRLIB_API void EventAssessmentStart(const FString& AssessmentName, TMap<FString, FString>& Meta);
 	ABXRLIB_API void EventAssessmentStart(const FString& AssessmentName);
@@ -156,4 +160,25 @@ namespace Abxr
 	ABXRLIB_API TMap<FString, FString> GetSuperMetaData();
 
 	ABXRLIB_API void LoadSuperMetaData();
+
+	// Gets the state of the data upload circuit breaker
+	// Open means the backend has been unreachable and uploads are paused; data keeps queueing locally
+	ABXRLIB_API EAbxrSendCircuitState GetSendCircuitState();
+
+	// Gets round-trip timings of AbxrLib's HTTP requests, including an estimate of the connection handshake cost
+	ABXRLIB_API FAbxrTransportStats GetTransportStats();
+
+	// Gets the fill level, high-water mark and drop count of the queue that buffers entries before they are batched
+	ABXRLIB_API FAbxrIngestStats GetIngestStats();
+
+	// Runs Capture on the game thread about every PeriodSeconds, alongside AbxrLib's own telemetry.
+	// Captures share a per-frame time budget, so a due capture may wait a frame; keep each one short.
+	// Returns a handle for UnregisterTelemetryCapture, or INDEX_NONE if AbxrLib is not initialized.
+	ABXRLIB_API int32 RegisterTelemetryCapture(FName Name, double PeriodSeconds, TFunction<void()> Capture);
+	ABXRLIB_API void UnregisterTelemetryCapture(int32 Handle);
+
+	// Adds a telemetry source alongside the built-in ones (thread times, memory, GC, streaming, device).
+	// AbxrLib keeps a reference until UnregisterTelemetryProvider or shutdown.
+	ABXRLIB_API void RegisterTelemetryProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider);
+	ABXRLIB_API void UnregisterTelemetryProvider(const TSharedRef<IAbxrTelemetryProvider>& Provider);
 }
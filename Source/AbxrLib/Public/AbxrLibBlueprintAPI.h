@@ -190,4 +190,13 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Abxr|MetaData")
 	static void LoadSuperMetaData();
+
+	UFUNCTION(BlueprintPure, Category = "Abxr|Network")
+	static EAbxrSendCircuitState GetSendCircuitState();
+
+	UFUNCTION(BlueprintPure, Category = "Abxr|Network")
+	static FAbxrTransportStats GetTransportStats();
+
+	UFUNCTION(BlueprintPure, Category = "Abxr|Network")
+	static FAbxrIngestStats GetIngestStats();
 };
@@ -0,0 +1,22 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * A source of periodic telemetry. Register one with Abxr::RegisterTelemetryProvider and Capture is called
+ * on the game thread about every GetPeriodSeconds(), inside the per-frame telemetry budget.
+ * Report readings from Capture with Abxr::TelemetryTyped; skipping a call (nothing changed, nothing to read) is fine.
+ */
+class IAbxrTelemetryProvider
+{
+public:
+	virtual ~IAbxrTelemetryProvider() = default;
+
+	// Used in overrun reports
+	virtual FName GetName() const = 0;
+	virtual double GetPeriodSeconds() const = 0;
+	virtual void Capture() = 0;
+
+	// Called when the provider is registered and unregistered, e.g. to bind engine delegates
+	virtual void Start() {}
+	virtual void Stop() {}
+};
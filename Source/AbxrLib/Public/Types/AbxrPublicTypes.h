@@ -41,6 +41,94 @@ enum class EInteractionType : uint8
 	Sequencing
 };
 
+// State of the circuit breaker in front of data uploads
+UENUM(BlueprintType)
+enum class EAbxrSendCircuitState : uint8
+{
+	Closed,    // uploads flowing normally (possibly backing off between retries)
+	Open,      // too many consecutive failures; uploads paused for a cool-down
+	HalfOpen   UMETA(DisplayName = "Half Open")  // cool-down over; a single probe request decides
+};
+
+// Round-trip timings of AbxrLib's HTTP requests. A request is "cold" when its host had been idle long enough for the
+// pooled connection to have closed, so it most likely paid for a new TCP + TLS handshake
+USTRUCT(BlueprintType)
+struct FAbxrTransportStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 Requests = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 ColdRequests = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 Prewarms = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") double LastRttMs = 0.0;
+	// Moving averages
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") double WarmRttMs = 0.0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") double ColdRttMs = 0.0;
+	// ColdRttMs - WarmRttMs once both have samples
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") double HandshakeEstimateMs = 0.0;
+};
+
+// Fill level of the queue that takes entries from any thread before the data service batches them.
+// Dropped counts entries lost to a full queue under the configured overflow policy
+USTRUCT(BlueprintType)
+struct FAbxrIngestStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 Capacity = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 Queued = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int32 HighWaterMark = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Abxr") int64 Dropped = 0;
+};
+
+// Handle to a string interned in AbxrLib's string table. Copying, comparing and hashing it never allocates;
+// keep the ones you use every frame around (e.g. as statics) so the lookup happens once.
+// The table is capped; once it is full, new strings get an atom that carries its own copy instead.
+struct ABXRLIB_API FAbxrAtom
+{
+	FAbxrAtom() = default;
+	explicit FAbxrAtom(FStringView Text);
+
+	const FString& ToString() const;
+	bool IsNone() const { return Id == 0; }
+	bool IsInterned() const { return !Uninterned.IsValid(); }
+	// UninternedId for atoms created after the table filled up
+	uint32 GetId() const { return Id; }
+
+	// A string is either in the table or not for the whole run, so interned and uninterned atoms never match
+	friend bool operator==(const FAbxrAtom& A, const FAbxrAtom& B)
+	{
+		return A.Id == B.Id && (A.IsInterned() || A.Uninterned->Equals(*B.Uninterned, ESearchCase::CaseSensitive));
+	}
+	friend bool operator!=(const FAbxrAtom& A, const FAbxrAtom& B) { return !(A == B); }
+	friend uint32 GetTypeHash(const FAbxrAtom& Atom) { return Atom.IsInterned() ? Atom.Id : GetTypeHash(*Atom.Uninterned); }
+
+	static constexpr uint32 UninternedId = MAX_uint32;
+
+private:
+	uint32 Id = 0;
+	TSharedPtr<const FString, ESPMode::ThreadSafe> Uninterned;
+};
+
+enum class EAbxrTelemetryFormat : uint8
+{
+	Decimal,  // 6 decimal places, like LexToString
+	Integer   // truncated to a whole number
+};
+
+// One numeric field of a typed telemetry record; it is turned into text only when the batch is encoded
+struct FAbxrTelemetryField
+{
+	FAbxrTelemetryField() = default;
+	FAbxrTelemetryField(const FAbxrAtom InKey, const double InValue, const EAbxrTelemetryFormat InFormat = EAbxrTelemetryFormat::Decimal, const FAbxrAtom InUnit = FAbxrAtom())
+		: Key(InKey), Unit(InUnit), Value(InValue), Format(InFormat) {}
+
+	FAbxrAtom Key;
+	FAbxrAtom Unit;  // appended to the value as-is, e.g. " MB"
+	double Value = 0.0;
+	EAbxrTelemetryFormat Format = EAbxrTelemetryFormat::Decimal;
+};
+
 USTRUCT(BlueprintType)
 struct FAbxrModuleData
 {